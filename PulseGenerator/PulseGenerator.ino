@@ -37,75 +37,388 @@
  * @version 0.7 2019-07-01
  *      Added settings propagation to menu.
  *      Source code reorganized to Env.h.
+ * @version 0.8 2026-10-18
+ *      Added cycle exact loop and output timing benchmark.
+ *      Added per-function cycle profiler.
+ *      Added display frame timing per screen and fast I2C option.
+ *      Added EEPROM wear benchmark.
+ *      Added potentiometer smooth filter.
+ *      Fixed timing after millis() rollover.
+ *      Added serial link control commands.
+ *      Added serial link live status.
+ *      Added input storm stress test.
+ *      Added hot path cycle budgets.
+ *      Added input to display latency histograms.
+ *      Added adaptive A/D sampling and display refresh rates.
+ *      Added fault log with diagnostics screen.
+ *      Splash screen does not block generator.
+ *      Added compile-time variant feature profiles.
+ *      Added unit types, fixed pulse timing.
+ *      Compact menu item layout.
+ *      Added remote menu browser via serial link.
+ *      Frequency floating item shown without smooth filter, diagnostics item enabled by faults.
+ *      Settings values are edited inline in menu row with row band repaint.
+ *      Menu rows are scrolled by display hardware, only changed rows are rendered.
+ *      Added hardware SPI display transport option.
+ *      Added status bar with filter, curve, output, mode and fault icons on generator screen.
+ *      Added optional grid menu of icon cells.
+ *      Long click on generator screen pauses and resumes output.
  */
 
+/* Check unit types arithmetic overflows at runtime (debug builds) */
+// #define UNITS_CHECKED
+
+/* Grid menu of icon cells instead of text rows */
+// #define MENU_GRID
+
+/* Compact menu items, byte ids, flash captions, static pool fitting all items from Env.h with
+ * two spare items */
+#define QMENU_POLICY QMenuCompactPolicy
+#define QMENU_POOL_SIZE 18
+
 #include <Arduino.h>
 #include <EEPROM.h>
 #include "U8glib.h"
 #include "lib/RotaryEncoder.h"
 #include "lib/QMenu.h"
+#include "lib/Variant.h"
+#include "lib/Units.h"
+#include "lib/Faults.h"
+#ifdef FAULT_LOG
+#include "lib/FaultLog.h"
+#endif
+#include "lib/Coroutine.h"
 #include "lib/Env.h"
+#include "lib/OledScroll.h"
+#include "lib/StatusIcons.h"
+#include "lib/MenuIcons.h"
+
+#if QMENU_POOL_SIZE < MENU_ITEM_COUNT
+#error "QMENU_POOL_SIZE does not fit all menu items"
+#endif
+
+/* Screen types */
+#define SCREEN_SPLASH 0
+#define SCREEN_GENERATOR 1
+#define SCREEN_MENU 2
+#define SCREEN_MEASURE 3
+#define SCREEN_COUNT 4
 
-/* Enable serial link */
+/* Enable serial link, it is always enabled in development variant, see Variant.h */
 // #define SERIAL_LOG
 
-/* Output pin */
+/* Serial link control commands, one command per line:
+ *  r[n] - rotate encoder right by n detents (default 1)
+ *  l[n] - rotate encoder left by n detents (default 1)
+ *  c    - encoder click
+ *  L    - encoder long click
+ *  p[n] - override potentiometer A/D value by n (0-1023), without n releases override
+ *  f    - print current frequency in Hz
+ *  s[n] - print live status line, s1 starts status streaming, s0 stops it
+ *  x[n] - run input storm stress test with random seed n (default 1), same seed replays same
+ *         storm, settings changed by storm are restored and not saved, ignored while storm runs
+ *  h    - print input to display latency histograms per screen type
+ *  e[n] - print fault counters and fault log, e0 clears them, not present in basic variant
+ *  m[n] - browse menu remotely, independently of display: m1 next, m2 previous, m3 enter,
+ *         m4 back, without n prints remote viewport
+ */
+#ifdef SERIAL_LOG
+#include "lib/SerialCommand.h"
+SerialCommand serialCommand(Serial);
+
+/* Live status streaming period in ms */
+#define STATUS_PERIOD 200
+bool statusStreaming = false;
+unsigned long statusLastReport;
+unsigned long statusLoopStart;
+unsigned long statusLoopCount;
+unsigned long statusLoopMicrosMax;
+
+/* Input storm stress test, one random input event is injected per loop. Storm starts and ends
+ * on generator screen with settings snapshot restored, so runs with the same seed replay.
+ * Serial flood event feeds a line of random command characters to command parser, commands
+ * which change state outside of storm (streaming, fault log, storm itself) are left out. Worst
+ * loop, input handling and output edge lateness are reported with event index causing them. */
+#define STRESS_EVENTS 500
+#define STRESS_SEED 1
+#define STRESS_FLOOD_MAX 16
+const char stressFloodChars[] PROGMEM = "rlcLpfhmz0123456789- \n";
+unsigned long stressSeed;
+Settings stressSettings;
+bool stressOutputPaused;
+word stressIndex = STRESS_EVENTS;
+unsigned long stressLoopMax;
+word stressLoopMaxIndex;
+unsigned long stressInputMax;
+word stressInputMaxIndex;
+unsigned long stressEdgeMax;
+word stressEdgeMaxIndex;
+#endif
+
+/* Input to display latency histograms, bucket 0 counts latencies under 1 ms, bucket n counts
+ * latencies from 2^(n-1) ms to 2^n ms, last bucket counts all longer latencies */
+#ifdef SERIAL_LOG
+#define LATENCY_BUCKETS 10
+bool latencyPending = false;
+unsigned long latencyInputTime;
+word latencyHistogram[SCREEN_COUNT][LATENCY_BUCKETS];
+#endif
+
+/* Enable loop, output and display frame timing benchmark, reported via serial link */
+// #define BENCHMARK
+#if defined(BENCHMARK) && !defined(SERIAL_LOG)
+#error "BENCHMARK requires SERIAL_LOG"
+#endif
+
+/* Enable per-function cycle profiler, reported via serial link in collapsed stack format.
+ * Hot paths have worst case cycle budgets, exceeded budgets are reported with the profile. */
+// #define PROFILER
+#if defined(PROFILER) && !defined(SERIAL_LOG)
+#error "PROFILER requires SERIAL_LOG"
+#endif
+
+#ifdef PROFILER
+#include "lib/Profiler.h"
+#define PROFILER_REPORT_PERIOD 5000
+#define PROFILE_SCOPE(name, line) ProfilerScope profilerScope##line(PSTR(name))
+#define PROFILE_LINE(name, line) PROFILE_SCOPE(name, line)
+#define PROFILE(name) PROFILE_LINE(name, __LINE__)
+#define PROFILE_BUDGET_SCOPE(name, budget, line) ProfilerScope profilerScope##line(PSTR(name), budget)
+#define PROFILE_BUDGET_LINE(name, budget, line) PROFILE_BUDGET_SCOPE(name, budget, line)
+#define PROFILE_BUDGET(name, budget) PROFILE_BUDGET_LINE(name, budget, __LINE__)
+unsigned long profilerLastReport;
+#else
+#define PROFILE(name)
+#define PROFILE_BUDGET(name, budget)
+#endif
+
+/* Worst case cycle budgets of hot paths */
+#define BUDGET_PULSE_CYCLES 800
+#define BUDGET_FREQ_READ_CYCLES 4000
+
+#ifdef BENCHMARK
+#include "lib/CycleCounter.h"
+#define BENCHMARK_REPORT_PERIOD 1000
+unsigned long benchmarkLastReport;
+unsigned long benchmarkLoopStart;
+unsigned long benchmarkLoopCount;
+unsigned long benchmarkLoopCyclesSum;
+unsigned long benchmarkLoopCyclesMax;
+unsigned long benchmarkLastEdge;
+unsigned long benchmarkPeriodMin;
+unsigned long benchmarkPeriodMax;
+
+/* Display frame statistics per screen type */
+struct BenchmarkFrameStats {
+    unsigned long count;
+    unsigned long microsSum;
+    unsigned long microsMax;
+};
+BenchmarkFrameStats benchmarkFrames[SCREEN_COUNT];
+
+/* Measures display frame duration from construction till the end of scope */
+class BenchmarkFrame {
+    private:
+        byte _screen;
+        unsigned long _start;
+
+    public:
+        BenchmarkFrame(byte screen) {
+            _screen = screen;
+            _start = micros();
+        }
+
+        ~BenchmarkFrame() {
+            unsigned long duration = micros() - _start;
+            BenchmarkFrameStats &stats = benchmarkFrames[_screen];
+            stats.count++;
+            stats.microsSum += duration;
+            stats.microsMax = max(stats.microsMax, duration);
+        }
+};
+#define BENCHMARK_FRAME(screen) BenchmarkFrame benchmarkFrame(screen)
+
+/* EEPROM cell endurance in write cycles */
+#define BENCHMARK_EEPROM_ENDURANCE 100000
+
+/* Usage scenario of lifetime projection, settings are saved on every menu exit */
+#define BENCHMARK_EEPROM_SAVES_PER_DAY 100
+
+/* Settings EEPROM cells writes and settings saves since boot */
+word benchmarkEepromWrites[sizeof(Settings)];
+word benchmarkEepromSaves = 0;
+#else
+#define BENCHMARK_FRAME(screen)
+#endif
+
+/* Output pin, pin 13 is SPI clock when display is on SPI */
+#if OLED_TRANSPORT == OLED_TRANSPORT_SPI
+#define PIN_OUTPUT 2
+#else
 #define PIN_OUTPUT 13
+#endif
 
 /* Freauency controlling potentiometer */
 #define FREQ_PIN A0
 #define FREQ_INPUT_MIN 0
 #define FREQ_INPUT_MAX 1023
-#define FREQ_AD_REFRESH_PERIOD 50
-long adLastRefresh;
+unsigned long adLastRefresh;
 
-//#define BUZZER_PRESENT
-#ifdef BUZZER_PRESENT
-#define BUZZER_PIN 7
+/* Potentiometer smooth filter, exponential moving average with 1/2^FREQ_FILTER_SHIFT weight
+ * of new sample, filtered value is kept with FREQ_FILTER_FRACTION_BITS fraction bits */
+#define FREQ_FILTER_SHIFT 2
+#define FREQ_FILTER_FRACTION_BITS 4
+int freqFiltered = -1;
+
+/* Potentiometer A/D value overriden via serial link or -1 if not overriden */
+#ifdef SERIAL_LOG
+int freqInputOverride = -1;
 #endif
 
+/* Buzzer, present if enabled in variant */
+#define BUZZER_PIN 7
+
 /* Rotary encoder controller */
 #define ENCODER_CLK 5
 #define ENCODER_DT 4
 #define ENCODER_SW 3
 RotaryEncoder encoder(ENCODER_CLK, ENCODER_DT, ENCODER_SW);
 
-/* OLED Display 128x64 */
-U8GLIB_SSD1306_128X64 oled(U8G_I2C_OPT_NONE);
+/* OLED Display 128x64, hardware SPI runs at 8 MHz (SCK 13, MOSI 11), I2C bus at 400 kHz or
+100 kHz by variant */
+#if OLED_TRANSPORT == OLED_TRANSPORT_SPI
+#define OLED_SPI_CS 10
+#define OLED_SPI_A0 9
+#define OLED_SPI_RESET 8
+U8GLIB_SSD1306_128X64 oled(OLED_SPI_CS, OLED_SPI_A0, OLED_SPI_RESET);
+#else
+U8GLIB_SSD1306_128X64 oled(Variant::oledI2cFast ? U8G_I2C_OPT_FAST : U8G_I2C_OPT_NONE);
+#endif
+
+/* Hardware scrolling of menu rows, menu is drawn shifted by menuOffsetY in partial frames */
+OledScroll oledScroll(&oled);
+u8g_uint_t menuOffsetY = 0;
 
 /* Menu controller and renederer */
-#define MENU_SIZE 5
-QMenu menu(MENU_GENERATOR, "Generator");
-QMenuListRenderer menuRenderer(&menu, MENU_SIZE);
+const char menuRootCaption[] PROGMEM = "Generator";
+QMenu menu(MENU_GENERATOR, (const __FlashStringHelper*) menuRootCaption);
+#ifdef MENU_GRID
+/* Grid of 4x2 page aligned cells of 32x24 pixels over two pages high caption line */
+#define MENU_GRID_WIDTH 128
+#define MENU_GRID_COLUMNS 4
+#define MENU_GRID_ROWS 2
+#define MENU_GRID_CAPTION_HEIGHT 13
+QMenuGridRenderer menuRenderer(&menu, MENU_GRID_WIDTH, OLED_SCROLL_HEIGHT, MENU_GRID_COLUMNS,
+        MENU_GRID_ROWS, MENU_GRID_CAPTION_HEIGHT);
+#else
+QMenuListRenderer menuRenderer(&menu, Variant::menuRows);
+#endif
+
+/* Remote menu browser, own cursor and viewport over the same menu tree */
+#ifdef SERIAL_LOG
+#define REMOTE_MENU_NEXT 1
+#define REMOTE_MENU_PREV 2
+#define REMOTE_MENU_ENTER 3
+#define REMOTE_MENU_BACK 4
+QMenuCursor remoteCursor(menu.getRoot());
+QMenuListRenderer remoteRenderer(&remoteCursor, Variant::menuRows);
+#endif
 
 /* Drawing values */
 #define GL_BASE_PADDING 1
 #define GL_MENU_PADDING 1
 
-/* Display render period in ms */
-#define OLED_REFRESH_PERIOD 200
+/* Adaptive rate governor, A/D sampling and generator display refresh periods in ms are set
+ * to minimum while potentiometer or encoder is active and doubled on every idle refresh up
+ * to maximum. Minimal display period is bounded by twice the measured full frame time to
+ * leave at least half of loop time to other tasks. */
+#define FREQ_AD_REFRESH_PERIOD_MIN 10
+#define FREQ_AD_REFRESH_PERIOD_MAX 100
+#define OLED_REFRESH_PERIOD_MIN 50
+#define OLED_REFRESH_PERIOD_MAX 1000
+#define ACTIVITY_HOLD_PERIOD 500
+#define ACTIVITY_AD_THRESHOLD 4
+word adRefreshPeriod = FREQ_AD_REFRESH_PERIOD_MIN;
+word oledRefreshPeriod = OLED_REFRESH_PERIOD_MIN;
+unsigned long activityTime;
+unsigned long oledFrameMillis = 0;
+int freqInputLast = -1;
+
+/* Generator screen needs redraw */
+bool generatorDirty = true;
+
+/* Status bar on generator screen lives in display page 0 and is redrawn only when its state
+ * changes. State packs icon flags in low byte and capped fault count in high byte. Page 0
+ * redraw delays output edges, so change of fault count alone is drawn with the next value
+ * frame and bar redraw never records faults of its own. */
+#define STATUS_BAR_PAGES 0x01
+#define STATUS_BAR_FILTER 0x01
+#define STATUS_BAR_QUADRATIC 0x02
+#define STATUS_BAR_RUNNING 0x04
+#define STATUS_BAR_HZ 0x08
+#define STATUS_BAR_FLAGS 0x00FF
+#define STATUS_BAR_FAULTS_MAX 99
+#define STATUS_BAR_INVALID 0xFFFF
+#define STATUS_BAR_SPACING 2
+word statusBarDrawn = STATUS_BAR_INVALID;
+
+/* Fault log, timing faults are recorded when task or pulse edge is late by more than tolerance
+ * in ms, EEPROM stall when settings saving blocks loop for more than given time in ms. Display
+ * frames are flushed synchronously, frame blocking loop for more than given time in ms is
+ * recorded as frame stall, so late tasks and edges can be tied to the frame preceding them. */
+#define FAULT_TASK_TOLERANCE 50
+#define FAULT_PULSE_TOLERANCE 2
+#define FAULT_EEPROM_STALL_TIME 20
+#define FAULT_FRAME_STALL_TIME 50
+#ifndef SERIAL_RX_BUFFER_SIZE
+#define SERIAL_RX_BUFFER_SIZE 64
+#endif
+#ifdef FAULT_LOG
+FaultLog faults;
+#endif
+
+/* Splash screen duration in ms, set to 0 to skip splash and boot straight to generator */
+#define SPLASH_PERIOD 2000
+
+/* Splash fade out, contrast is lowered by step every period in ms, then restored */
+#define SPLASH_FADE_STEP 32
+#define SPLASH_FADE_PERIOD 40
+#define OLED_CONTRAST 0xCF
+
+/* Splash flow running in loop without blocking generator */
+Coroutine splashFlow;
+int splashContrast;
 
 Settings settings = {
     SETTINGS_HEADER_VERSION, // Settings header in EEPROM
-    SETTINGS_MIN_FREQ_MIN,
-    SETTINGS_MAX_FREQ_MAX,
-    SETTINGS_PULSE_WIDTH_MIN,
+    Hertz(SETTINGS_MIN_FREQ_MIN),
+    Hertz(SETTINGS_MAX_FREQ_MAX),
+    Milliseconds(SETTINGS_PULSE_WIDTH_MIN),
     ACCELERATION_SHAPE_LINEAR, // default acceleration type
     0, // default frequency floating 0%
     FREQ_UNITS_RPM,
     false
 };
 
-/* Last renreding millis */
-long oledLastRefresh;
+/* Last renreding millis, all time stamps are compared as differences to survive millis()
+ * rollover after 49.7 days */
+unsigned long oledLastRefresh;
 
 /* Current menu item selected */
 QMenuItem* selected = NULL;
 
-/* Current working frequency */
-word frequency = settings.minFreq;
+/* Current working frequency, output state and last output edge time in micros. Pulse high
+ * and low times are computed by updatePulseTiming() when frequency or pulse width changes, so
+ * the pulse path does no division. */
+Hertz frequency = settings.minFreq;
+Microseconds pulseHigh;
+Microseconds pulseLow;
 int pulseState = LOW;
-long pulseLastTime;
+unsigned long pulseLastTime;
+
+/* Output paused by long click on generator screen, pulse in progress is finished and output
+ * is held low */
+bool outputPaused = false;
 
 /* Settings value measuring flag */
 bool measureSettingsValue = false;
@@ -115,19 +428,49 @@ void setup() {
     #ifdef SERIAL_LOG
     Serial.begin(9600);
     Serial.println("Serial logging enabled.");
+    serialCommand.setOnCommand(serialOnCommand);
+    remoteCursor.setOnActiveItemChanged(remoteActiveItemChanged);
+    remoteCursor.setOnItemUtilized(remoteItemUtilized);
+    remoteRenderer.setOnRenderItem(remoteRenderItem);
+    #endif
+
+    #if defined(BENCHMARK) || defined(PROFILER)
+    CycleCounter::begin();
+    #endif
+
+    #ifdef BENCHMARK
+    benchmarkReset();
+    #endif
+
+    #ifdef PROFILER
+    profilerLastReport = millis();
     #endif
 
     // Set output pin
     pinMode(PIN_OUTPUT, OUTPUT);
 
+    // Double SPI clock to F_CPU / 2, display library sets F_CPU / 4
+    #if OLED_TRANSPORT == OLED_TRANSPORT_SPI
+    SPSR |= _BV(SPI2X);
+    #endif
+
     //Set menu events and create structure
     menu.setOnActiveItemChanged(activeItemChanged);
     menu.setOnItemUtilized(onItemUtilized);
+    QMenuItem::setVisiblePredicate(isMenuItemVisible);
+    QMenuItem::setEnabledPredicate(isMenuItemEnabled);
     populateMenu(menu);
     selected = menu.getActive();
+    #ifdef BENCHMARK
+    benchmarkMenuLayout();
+    #endif
 
     // Setup menu rederer
+    #ifdef MENU_GRID
+    menuRenderer.setOnRenderItem(onRenderMenuGridItem);
+    #else
     menuRenderer.setOnRenderItem(onRenderMenuItem);
+    #endif
 
     // Setup encoder
     encoder.setOnChange(encoderOnChange);
@@ -141,20 +484,23 @@ void setup() {
 
     // Read frequency from A/D
     frequency = readFrequnecyValue();
+    updatePulseTiming();
 
-    #ifdef BUZZER_PRESENT
-    pinMode(BUZZER_PIN, OUTPUT);
-    noTone(BUZZER_PIN);
-    #endif
+    if (Variant::buzzer) {
+        pinMode(BUZZER_PIN, OUTPUT);
+        noTone(BUZZER_PIN);
+    }
 
     // Render menu
     oledLastRefresh = millis();
     adLastRefresh = millis();
+    activityTime = millis();
 
-    renderSplash();
-    delay(2000);
+    #if SPLASH_PERIOD > 0
+    splashFlow.start();
+    #endif
 
-    pulseLastTime = millis();
+    pulseLastTime = micros();
 }
 
 /* Render splash screen */
@@ -169,52 +515,556 @@ void renderSplash() {
     u8g_uint_t fontHeight = oled.getFontAscent() - oled.getFontDescent();
     u8g_uint_t left = u8gCenter(oled.getWidth(), textWidth);
     u8g_uint_t top = u8gCenter(oled.getHeight(), fontHeight);
+    BENCHMARK_FRAME(SCREEN_SPLASH);
+    unsigned long frameStart = millis();
+    oledScroll.reset();
     oled.firstPage();
     do {
         oled.drawStr(left, top, logo);
     } while (oled.nextPage());
+    frameFlushed(SCREEN_SPLASH, frameStart);
+}
+
+/* Splash flow: show splash, wait, fade out and continue to generator screen. Flow runs only
+ * on generator screen, entering menu stops it, see activeItemChanged(). */
+bool runSplashFlow(Coroutine &co) {
+    COROUTINE_BEGIN(co);
+    renderSplash();
+    COROUTINE_DELAY(co, SPLASH_PERIOD);
+
+    splashContrast = OLED_CONTRAST;
+    while (splashContrast > 0) {
+        splashContrast = max(splashContrast - SPLASH_FADE_STEP, 0);
+        oled.setContrast(splashContrast);
+        COROUTINE_DELAY(co, SPLASH_FADE_PERIOD);
+    }
+
+    oled.setContrast(OLED_CONTRAST);
+    generatorDirty = true;
+    statusBarDrawn = STATUS_BAR_INVALID;
+    oledLastRefresh = millis();
+    COROUTINE_END(co);
 }
 
 /* Main Loop */
 void loop() {
-    encoder.update();
+    #ifdef BENCHMARK
+    benchmarkLoopStart = CycleCounter::now();
+    #endif
+
+    #ifdef SERIAL_LOG
+    statusLoopStart = micros();
+    #endif
+
+    #ifdef PROFILER
+    Profiler::enter(PSTR("loop"));
+    #endif
+
+    {
+        PROFILE("encoder.update");
+        encoder.update();
+    }
+
+    #ifdef SERIAL_LOG
+    if (Serial.available() >= SERIAL_RX_BUFFER_SIZE - 1) {
+        recordFault(FAULT_SERIAL_OVERFLOW, Serial.available());
+    }
+    serialCommand.update();
+    stressInject();
+    #endif
 
     // Generator update
     if (selected->getId() == MENU_GENERATOR) {
 
         // Read frequency from A/D if the time comes
-        if (adLastRefresh + FREQ_AD_REFRESH_PERIOD < millis()) {
-            frequency = readFrequnecyValue();
+        if (millis() - adLastRefresh > adRefreshPeriod) {
+            checkTaskLate(adLastRefresh, adRefreshPeriod);
+            Hertz value = readFrequnecyValue();
+            if (value != frequency) {
+                frequency = value;
+                updatePulseTiming();
+                generatorDirty = true;
+            }
             adLastRefresh = millis();
+            adRefreshPeriod = governPeriod(adRefreshPeriod, FREQ_AD_REFRESH_PERIOD_MIN,
+                    FREQ_AD_REFRESH_PERIOD_MAX);
         }
 
-        // Render displat values in the time comes
-        if (oledLastRefresh + OLED_REFRESH_PERIOD < millis()) {
-            renderGenerator();
+        // Run splash flow, render displat values in the time comes and something changed
+        if (splashFlow.isRunning()) {
+            runSplashFlow(splashFlow);
+        } else if (millis() - oledLastRefresh > oledRefreshPeriod) {
+            checkTaskLate(oledLastRefresh, oledRefreshPeriod);
+            word statusBar = getStatusBar();
+            if (generatorDirty || ((statusBar ^ statusBarDrawn) & STATUS_BAR_FLAGS)) {
+                renderGenerator(statusBar);
+                generatorDirty = false;
+            }
             oledLastRefresh = millis();
+            oledRefreshPeriod = governPeriod(oledRefreshPeriod,
+                    max(OLED_REFRESH_PERIOD_MIN, oledFrameMillis * 2), OLED_REFRESH_PERIOD_MAX);
         }
 
-        #ifdef BUZZER_PRESENT
-        tone(BUZZER_PIN, 480);
-        #endif
+        if (Variant::buzzer) {
+            tone(BUZZER_PIN, 480);
+        }
 
         // Pulse output
-        long pulseDelta = millis() - pulseLastTime;
+        PROFILE_BUDGET("pulse", BUDGET_PULSE_CYCLES);
+        // Pulse is HIGH for pulse width and LOW for the rest of period
+        Microseconds pulseDelta(micros() - pulseLastTime);
         // Pulse UP
-        if (pulseState == LOW && pulseDelta >= settings.pulseWidth) {
+        if (pulseState == LOW && !outputPaused && pulseDelta >= pulseLow) {
+            #ifdef FAULT_LOG
+            Microseconds pulseTolerance = toMicroseconds(Milliseconds(FAULT_PULSE_TOLERANCE));
+            if (pulseDelta > pulseLow + pulseTolerance) {
+                recordFault(FAULT_PULSE_LATE, (pulseDelta - pulseLow).value() / 1000);
+            }
+            #endif
+            #ifdef SERIAL_LOG
+            stressEdge((pulseDelta - pulseLow).value());
+            #endif
             pulseState = HIGH;
             digitalWrite(PIN_OUTPUT, pulseState);
-            pulseLastTime = millis();
-        } else if (pulseState == HIGH && (1 / frequency - settings.pulseWidth) >= pulseDelta) {
+            pulseLastTime = micros();
+            #ifdef BENCHMARK
+            benchmarkRisingEdge();
+            #endif
+        } else if (pulseState == HIGH && pulseDelta >= pulseHigh) {
+            #ifdef SERIAL_LOG
+            stressEdge((pulseDelta - pulseHigh).value());
+            #endif
             pulseState = LOW;
             digitalWrite(PIN_OUTPUT, pulseState);
-            pulseLastTime = millis();
+            pulseLastTime = micros();
         }
     }
+
+    #ifdef PROFILER
+    Profiler::leave();
+    profilerLoop();
+    #endif
+
+    #ifdef BENCHMARK
+    benchmarkLoop();
+    #endif
+
+    #ifdef SERIAL_LOG
+    statusLoop();
+    #endif
+}
+
+#ifdef SERIAL_LOG
+/* Measures loop duration and streams status if enabled */
+void statusLoop() {
+    unsigned long duration = micros() - statusLoopStart;
+    statusLoopCount++;
+    statusLoopMicrosMax = max(statusLoopMicrosMax, duration);
+    stressMeasure(duration);
+
+    if (statusStreaming && millis() - statusLastReport >= STATUS_PERIOD) {
+        printStatus();
+    }
+}
+
+/* Starts input storm stress test, ignored while storm is running so its settings snapshot
+ * is kept */
+void stressStart(unsigned long seed) {
+    if (stressIndex < STRESS_EVENTS) {
+        return;
+    }
+
+    stressSeed = seed;
+    stressSettings = settings;
+    stressOutputPaused = outputPaused;
+    stressIndex = 0;
+    stressReturnToGenerator();
+    randomSeed(seed);
+    stressLoopMax = 0;
+    stressLoopMaxIndex = 0;
+    stressInputMax = 0;
+    stressInputMaxIndex = 0;
+    stressEdgeMax = 0;
+    stressEdgeMaxIndex = 0;
+}
+
+/* Leaves menu or measuring to generator screen, settings are not saved while storm runs */
+void stressReturnToGenerator() {
+    measureSettingsValue = false;
+    menuRenderer.setEditing(false);
+    while (selected->getId() != MENU_GENERATOR) {
+        menu.back();
+    }
+}
+
+/* Returns to generator screen and restores settings changed by storm */
+void stressFinish() {
+    freqInputOverride = -1;
+    stressReturnToGenerator();
+    settings = stressSettings;
+    setOutputPaused(stressOutputPaused);
+    propagateSettingsToMenu(settings, menu);
+    updatePulseTiming();
+    generatorDirty = true;
+    statusBarDrawn = STATUS_BAR_INVALID;
 }
 
-/* Render main screen */
-void renderGenerator() {
+/* Injects next random input event of running stress test and measures its handling */
+void stressInject() {
+    if (stressIndex >= STRESS_EVENTS) {
+        return;
+    }
+
+    unsigned long start = micros();
+    long kind = random(11);
+    if (kind < 3) {
+        RotaryEncoderOnChangeEvent change = { right, 0 };
+        encoderOnChange(change);
+    } else if (kind < 6) {
+        RotaryEncoderOnChangeEvent change = { left, 0 };
+        encoderOnChange(change);
+    } else if (kind == 6) {
+        encoderOnClick();
+    } else if (kind == 7) {
+        encoderOnLongClick();
+    } else if (kind == 8) {
+        freqInputOverride = random(FREQ_INPUT_MIN, FREQ_INPUT_MAX + 1);
+    } else if (kind == 9) {
+        freqInputOverride = random(2) ? FREQ_INPUT_MAX : FREQ_INPUT_MIN;
+    } else {
+        for (long count = random(1, STRESS_FLOOD_MAX + 1); count > 0; count--) {
+            serialCommand.feed(pgm_read_byte(
+                    &stressFloodChars[random(sizeof(stressFloodChars) - 1)]));
+        }
+        serialCommand.feed('\n');
+    }
+    unsigned long duration = micros() - start;
+
+    if (duration > stressInputMax) {
+        stressInputMax = duration;
+        stressInputMaxIndex = stressIndex;
+    }
+}
+
+/* Records output edge lateness in us of running stress test */
+void stressEdge(unsigned long lateness) {
+    if (stressIndex < STRESS_EVENTS && lateness > stressEdgeMax) {
+        stressEdgeMax = lateness;
+        stressEdgeMaxIndex = stressIndex;
+    }
+}
+
+/* Records loop duration of running stress test and reports results when finished */
+void stressMeasure(unsigned long duration) {
+    if (stressIndex >= STRESS_EVENTS) {
+        return;
+    }
+
+    if (duration > stressLoopMax) {
+        stressLoopMax = duration;
+        stressLoopMaxIndex = stressIndex;
+    }
+
+    if (stressIndex + 1 == STRESS_EVENTS) {
+        stressFinish();
+    }
+    if (++stressIndex == STRESS_EVENTS) {
+        Serial.print("x seed ");
+        Serial.print(stressSeed);
+        Serial.print(" events ");
+        Serial.print(STRESS_EVENTS);
+        Serial.print(" loop max us ");
+        Serial.print(stressLoopMax);
+        Serial.print(" at ");
+        Serial.print(stressLoopMaxIndex);
+        Serial.print(" input max us ");
+        Serial.print(stressInputMax);
+        Serial.print(" at ");
+        Serial.print(stressInputMaxIndex);
+        Serial.print(" edge late max us ");
+        Serial.print(stressEdgeMax);
+        Serial.print(" at ");
+        Serial.println(stressEdgeMaxIndex);
+    }
+}
+
+#ifdef FAULT_LOG
+/* Prints fault counters and fault log entries from the newest */
+void printFaults() {
+    char name[16] = "";
+    for (byte code = 0; code < FAULT_LOG_CODES; code++) {
+        getFaultName(code, name);
+        Serial.print("e count ");
+        Serial.print(name);
+        Serial.print(' ');
+        Serial.println(faults.getCount(code));
+    }
+    for (byte index = 0; index < faults.getSize(); index++) {
+        const FaultLogEntry* entry = faults.get(index);
+        getFaultName(entry->code, name);
+        Serial.print("e ");
+        Serial.print(entry->time);
+        Serial.print(" ms ");
+        Serial.print(name);
+        Serial.print(' ');
+        Serial.println(entry->detail);
+    }
+}
+#endif
+
+/* Prints input to display latency histograms of screens with any input */
+void printLatencyHistograms() {
+    Serial.print("h ms <1");
+    for (byte bucket = 1; bucket < LATENCY_BUCKETS - 1; bucket++) {
+        Serial.print(" <");
+        Serial.print(1 << bucket);
+    }
+    Serial.print(" >=");
+    Serial.println(1 << (LATENCY_BUCKETS - 2));
+
+    for (byte screen = 0; screen < SCREEN_COUNT; screen++) {
+        Serial.print("h ");
+        printScreenName(screen);
+        for (byte bucket = 0; bucket < LATENCY_BUCKETS; bucket++) {
+            Serial.print(' ');
+            Serial.print(latencyHistogram[screen][bucket]);
+        }
+        Serial.println();
+    }
+}
+
+/* Prints status line with active item, output state and loop timing since last status */
+void printStatus() {
+    char units[16] = "";
+    getFreqUnits(settings, units);
+
+    Serial.print("s item ");
+    Serial.print(selected->getId());
+    Serial.print(" \"");
+    Serial.print(selected->getCaption());
+    Serial.print(measureSettingsValue ? "\" measure" : "\"");
+    Serial.print(" freq ");
+    Serial.print(getFreqByUnits(settings, frequency));
+    Serial.print(' ');
+    Serial.print(units);
+    Serial.print(" out ");
+    Serial.print(pulseState);
+    Serial.print(" loops ");
+    Serial.print(statusLoopCount);
+    Serial.print(" max us ");
+    Serial.println(statusLoopMicrosMax);
+
+    statusLastReport = millis();
+    statusLoopCount = 0;
+    statusLoopMicrosMax = 0;
+}
+#endif
+
+#ifdef PROFILER
+/* Reports collected profile periodically */
+void profilerLoop() {
+    if (millis() - profilerLastReport >= PROFILER_REPORT_PERIOD) {
+        Profiler::report(Serial);
+        Serial.println();
+        Profiler::reset();
+        profilerLastReport = millis();
+    }
+}
+#endif
+
+#ifdef BENCHMARK
+/* Prints display transport and its clock */
+void printOledTransport() {
+    #if OLED_TRANSPORT == OLED_TRANSPORT_SPI
+    Serial.print("spi 8000 kHz");
+    #else
+    Serial.print(Variant::oledI2cFast ? "i2c 400 kHz" : "i2c 100 kHz");
+    #endif
+}
+
+/* Clears benchmark statistics */
+void benchmarkReset() {
+    benchmarkLastReport = millis();
+    benchmarkLoopCount = 0;
+    benchmarkLoopCyclesSum = 0;
+    benchmarkLoopCyclesMax = 0;
+    benchmarkLastEdge = 0;
+    benchmarkPeriodMin = 0xFFFFFFFF;
+    benchmarkPeriodMax = 0;
+    memset(benchmarkFrames, 0, sizeof(benchmarkFrames));
+}
+
+/* Reports settings save cost and projects EEPROM lifetime for usage scenario from most worn
+ * cell writes per save */
+void benchmarkEepromSave(byte written, unsigned long duration) {
+    benchmarkEepromSaves++;
+
+    // Find most worn cell
+    byte worstCell = 0;
+    for (byte index = 1; index < sizeof(Settings); index++) {
+        if (benchmarkEepromWrites[index] > benchmarkEepromWrites[worstCell]) {
+            worstCell = index;
+        }
+    }
+    word worstWrites = benchmarkEepromWrites[worstCell];
+
+    Serial.print("eeprom save ");
+    Serial.print(written);
+    Serial.print(" bytes in ");
+    Serial.print(duration);
+    Serial.print(" us");
+    if (worstWrites > 0) {
+        // Writes per day of most worn cell at scenario saves per day
+        float writesPerDay = (float) worstWrites / benchmarkEepromSaves
+                * BENCHMARK_EEPROM_SAVES_PER_DAY;
+        Serial.print(", cell ");
+        Serial.print(SETTINGS_EEPROM_ADDRESS + worstCell);
+        Serial.print(" writes ");
+        Serial.print(worstWrites);
+        Serial.print(" in saves ");
+        Serial.print(benchmarkEepromSaves);
+        Serial.print(", projected lifetime days ");
+        Serial.print(BENCHMARK_EEPROM_ENDURANCE / writesPerDay);
+    }
+    Serial.println();
+}
+
+/* Counts menu items in level and its submenus */
+word benchmarkCountMenuItems(QMenuItem* item) {
+    word count = 0;
+    while (item != NULL) {
+        count += 1 + benchmarkCountMenuItems(item->getMenu());
+        item = item->getNext();
+    }
+    return count;
+}
+
+/* Reports RAM taken by menu items in selected layout and in full default layout */
+void benchmarkMenuLayout() {
+    word count = benchmarkCountMenuItems(menu.getRoot());
+    Serial.print("menu items ");
+    Serial.print(count);
+    Serial.print(", item bytes ");
+    Serial.print(sizeof(QMenuItem));
+    Serial.print(" total ");
+    Serial.print(count * sizeof(QMenuItem));
+    Serial.print(", default layout item bytes ");
+    Serial.print(sizeof(QMenuItemT<QMenuDefaultPolicy>));
+    Serial.print(" total ");
+    Serial.println(count * sizeof(QMenuItemT<QMenuDefaultPolicy>));
+}
+
+/* Measures output period between rising edges in cycles */
+void benchmarkRisingEdge() {
+    unsigned long now = CycleCounter::now();
+    if (benchmarkLastEdge != 0) {
+        unsigned long period = now - benchmarkLastEdge;
+        benchmarkPeriodMin = min(benchmarkPeriodMin, period);
+        benchmarkPeriodMax = max(benchmarkPeriodMax, period);
+    }
+    benchmarkLastEdge = now;
+}
+
+/* Measures loop duration in cycles and reports statistics periodically */
+void benchmarkLoop() {
+    unsigned long cycles = CycleCounter::elapsed(benchmarkLoopStart);
+    benchmarkLoopCount++;
+    benchmarkLoopCyclesSum += cycles;
+    benchmarkLoopCyclesMax = max(benchmarkLoopCyclesMax, cycles);
+
+    if (millis() - benchmarkLastReport >= BENCHMARK_REPORT_PERIOD) {
+        Serial.print("loop cycles avg ");
+        Serial.print(benchmarkLoopCyclesSum / benchmarkLoopCount);
+        Serial.print(" max ");
+        Serial.print(benchmarkLoopCyclesMax);
+        if (benchmarkPeriodMax > 0) {
+            Serial.print(", output period us min ");
+            Serial.print(CycleCounter::toMicros(benchmarkPeriodMin));
+            Serial.print(" max ");
+            Serial.print(CycleCounter::toMicros(benchmarkPeriodMax));
+        }
+        Serial.println();
+
+        for (byte screen = 0; screen < SCREEN_COUNT; screen++) {
+            BenchmarkFrameStats &stats = benchmarkFrames[screen];
+            if (stats.count > 0) {
+                Serial.print("frame ");
+                printOledTransport();
+                Serial.print(' ');
+                printScreenName(screen);
+                Serial.print(" count ");
+                Serial.print(stats.count);
+                Serial.print(" us avg ");
+                Serial.print(stats.microsSum / stats.count);
+                Serial.print(" max ");
+                Serial.println(stats.microsMax);
+            }
+        }
+        benchmarkReset();
+    }
+}
+#endif
+
+/* Gets status bar state from settings, output and fault log */
+word getStatusBar() {
+    byte flags = 0;
+    if (settings.useFilter) {
+        flags |= STATUS_BAR_FILTER;
+    }
+    if (settings.accelerationCurve == ACCELERATION_SHAPE_QUADRATIC) {
+        flags |= STATUS_BAR_QUADRATIC;
+    }
+    if (settings.freqUnits == FREQ_UNITS_HZ) {
+        flags |= STATUS_BAR_HZ;
+    }
+    if (!outputPaused) {
+        flags |= STATUS_BAR_RUNNING;
+    }
+    word faultCount = 0;
+    #ifdef FAULT_LOG
+    faultCount = min(faults.getTotal(), STATUS_BAR_FAULTS_MAX);
+    #endif
+    return (faultCount << 8) | flags;
+}
+
+/* Draws status bar icons, filter, curve and mode from left, output state and faults from right */
+void drawStatusBar(word state) {
+    u8g_uint_t left = 0;
+    if (Variant::filter) {
+        oled.drawBitmapP(left, 0, 1, STATUS_ICON_SIZE,
+                state & STATUS_BAR_FILTER ? statusIconFilterOn : statusIconFilterOff);
+        left += STATUS_ICON_SIZE + STATUS_BAR_SPACING;
+    }
+    oled.drawBitmapP(left, 0, 1, STATUS_ICON_SIZE,
+            state & STATUS_BAR_QUADRATIC ? statusIconCurveQuadratic : statusIconCurveLinear);
+    left += STATUS_ICON_SIZE + STATUS_BAR_SPACING;
+    oled.drawBitmapP(left, 0, 1, STATUS_ICON_SIZE,
+            state & STATUS_BAR_HZ ? statusIconModeHz : statusIconModeRpm);
+
+    u8g_uint_t right = oled.getWidth() - STATUS_ICON_SIZE;
+    oled.drawBitmapP(right, 0, 1, STATUS_ICON_SIZE,
+            state & STATUS_BAR_RUNNING ? statusIconRunning : statusIconPaused);
+
+    // Fault count digits from the last one, then warning sign
+    byte faultCount = state >> 8;
+    if (faultCount > 0) {
+        right -= STATUS_BAR_SPACING;
+        do {
+            right -= STATUS_DIGIT_WIDTH;
+            oled.drawBitmapP(right, STATUS_DIGIT_TOP, 1, STATUS_DIGIT_HEIGHT,
+                    statusDigits[faultCount % 10]);
+            faultCount /= 10;
+        } while (faultCount > 0);
+        right -= STATUS_ICON_SIZE;
+        oled.drawBitmapP(right, 0, 1, STATUS_ICON_SIZE, statusIconFault);
+    }
+}
+
+/* Render main screen, value pages only if generator is dirty and status bar page only if its
+ * state differs from the drawn one */
+void renderGenerator(word statusBar) {
+    PROFILE("renderGenerator");
+
     // Current frequency
     char freq[16] = "";
     sprintf(freq, "%d", getFreqByUnits(settings, frequency));
@@ -239,29 +1089,54 @@ void renderGenerator() {
     u8g_uint_t unitsTop = valueTop + valueHeight + GL_BASE_PADDING;
 
     // Render
-    oled.firstPage();
-    do {
-        // Current frequency
-        oled.setDefaultForegroundColor();
-        oled.setFont(u8g_font_fur30n);
-        oled.setFontRefHeightText();
-        oled.setFontPosTop();
-        oled.drawStr(valueLeft, valueTop, freq);
+    PROFILE("pages");
+    BENCHMARK_FRAME(SCREEN_GENERATOR);
+    unsigned long frameStart = millis();
+    oledScroll.reset();
+    byte pages = generatorDirty ? ~STATUS_BAR_PAGES : 0;
+    if (statusBar != statusBarDrawn) {
+        pages |= STATUS_BAR_PAGES;
+    }
+    if (oledScroll.firstPage(pages)) {
+        do {
+            // Status bar, clipped away on value pages
+            oled.setDefaultForegroundColor();
+            drawStatusBar(statusBar);
 
-        // Bottom line info
-        oled.setFont(u8g_font_6x13);
-        oled.setFontPosTop();
-        oled.drawStr(unitsLeft, unitsTop, units);
-    } while (oled.nextPage());
+            // Current frequency
+            oled.setFont(u8g_font_fur30n);
+            oled.setFontRefHeightText();
+            oled.setFontPosTop();
+            oled.drawStr(valueLeft, valueTop, freq);
+
+            // Bottom line info
+            oled.setFont(u8g_font_6x13);
+            oled.setFontPosTop();
+            oled.drawStr(unitsLeft, unitsTop, units);
+        } while (oledScroll.nextPage());
+    }
+    statusBarDrawn = statusBar;
+    frameFlushed(SCREEN_GENERATOR, frameStart);
+
+    // Partial frames are shorter, only full frames bound display refresh period
+    if (pages == 0xFF) {
+        oledFrameMillis = millis() - frameStart;
+    }
 }
 
-/* Render setup item value measuring */
-void renderMeasure() {
-    char value[16] = "";
+/* Gets settings item value followed by units as single text */
+void getSettingsText(byte id, char* text) {
     char units[16] = "";
+    getSettingsValue(id, text, units);
+    if (strlen(units) > 0) {
+        strcat(text, " ");
+        strcat(text, units);
+    }
+}
 
-    // Get value for measured item
-    switch (selected->getId()) {
+/* Gets settings item value and units as text */
+void getSettingsValue(byte id, char* value, char* units) {
+    switch (id) {
         case MENU_MIN_FREQ:
             sprintf(value, "%d", getFreqByUnits(settings, settings.minFreq));
             getFreqUnits(settings, units);
@@ -271,7 +1146,7 @@ void renderMeasure() {
             getFreqUnits(settings, units);
             break;
         case MENU_PULSE_WIDTH:
-            sprintf(value, "%d", settings.pulseWidth);
+            sprintf(value, "%d", settings.pulseWidth.value());
             strcpy(units, "ms");
             break;
         case MENU_FREQ_FLOATING:
@@ -282,11 +1157,34 @@ void renderMeasure() {
                 strcpy(units, "%");
             }
             break;
+        #ifdef FAULT_LOG
+        case MENU_DIAGNOSTICS:
+            // Fault count and last fault name
+            sprintf(value, "%u", faults.getTotal());
+            if (faults.getSize() > 0) {
+                getFaultName(faults.get(0)->code, units);
+            }
+            break;
+        #endif
     }
+}
+
+/* Render setup item value measuring */
+void renderMeasure() {
+    PROFILE("renderMeasure");
+
+    char value[16] = "";
+    char units[16] = "";
+
+    // Get value for measured item
+    getSettingsValue(selected->getId(), value, units);
 
     // Draw settings item value measure
     oled.setDefaultForegroundColor();
 
+    BENCHMARK_FRAME(SCREEN_MEASURE);
+    unsigned long frameStart = millis();
+    oledScroll.reset();
     oled.firstPage();
     do {
         // Measured item caption
@@ -311,19 +1209,220 @@ void renderMeasure() {
         }
 
     } while (oled.nextPage());
+    frameFlushed(SCREEN_MEASURE, frameStart);
 }
 
 
 /* Renders menu menu in current state on oled */
 void renderMenu() {
+    PROFILE("renderMenu");
+
+    BENCHMARK_FRAME(SCREEN_MENU);
+    unsigned long frameStart = millis();
+    oledScroll.reset();
     oled.firstPage();
     do {
         menuRenderer.render();
     } while (oled.nextPage());
+    frameFlushed(SCREEN_MENU, frameStart);
+}
+
+/* Gets display RAM pages of menu row band as drawn by onRenderMenuItem */
+byte getMenuRowPages(int row) {
+    if (row < 0 || row >= Variant::menuRows) {
+        return 0;
+    }
+    u8g_uint_t lineHeight = getMenuLineHeight();
+    u8g_uint_t top = lineHeight * row;
+    return oledScroll.getPageMask(top, top + lineHeight + GL_MENU_PADDING - 1);
+}
+
+/* Renders only given display RAM pages of menu, other pages keep their content on display */
+void renderMenuPages(byte pages) {
+    PROFILE("renderMenuPages");
+
+    BENCHMARK_FRAME(SCREEN_MENU);
+    unsigned long frameStart = millis();
+    if (oledScroll.firstPage(pages)) {
+        do {
+            for (byte copy = 0; copy < OLED_SCROLL_COPIES; copy++) {
+                menuOffsetY = oledScroll.getOffset(copy);
+                menuRenderer.render();
+            }
+        } while (oledScroll.nextPage());
+    }
+    menuOffsetY = 0;
+    frameFlushed(SCREEN_MENU, frameStart);
+}
+
+/* Gets if active item moved inside the same menu level, menu entered from generator screen or
+ * another level has nothing of the current level on display */
+bool isMenuMoveInLevel(const QMenuItem* oldActive) {
+    return oldActive != NULL && oldActive->getId() != MENU_GENERATOR
+            && oldActive->getBack() == selected->getBack();
+}
+
+#ifdef MENU_GRID
+/* Renders menu after active item moved. Move inside grid viewport renders only pages of old and
+ * new active cell and caption line. */
+void renderMenuMove(const QMenuItem* oldActive) {
+    if (!isMenuMoveInLevel(oldActive)) {
+        menuRenderer.invalidateViewport();
+    }
+    menuRenderer.updateViewport();
+    if (menuRenderer.getDirtyPages() == 0xFF) {
+        renderMenu();
+    } else {
+        renderMenuPages(menuRenderer.getDirtyPages());
+    }
+}
+
+/* Renders only display pages of caption line, used when value is edited inline */
+void renderMenuRow() {
+    renderMenuPages(menuRenderer.getCaptionPages());
+}
+#else
+/* Renders menu after active item moved in the same level. Viewport moved by one row is
+ * shifted by hardware scrolling, then only old and new active row and newly exposed lines
+ * are rendered. */
+void renderMenuMove(const QMenuItem* oldActive) {
+    int moved = menuRenderer.updateViewport();
+    if (!isMenuMoveInLevel(oldActive) || moved == QMENU_VIEWPORT_RESET
+            || moved < -1 || moved > 1) {
+        renderMenu();
+        return;
+    }
+
+    byte pages = 0;
+    if (moved != 0) {
+        u8g_uint_t lineHeight = getMenuLineHeight();
+        u8g_uint_t height = oled.getHeight();
+        oledScroll.scroll(moved * lineHeight);
+
+        // Exposed lines and lines below the last row showing scrolled content
+        pages |= moved > 0
+                ? oledScroll.getPageMask(height - lineHeight, height - 1)
+                : oledScroll.getPageMask(0, lineHeight - 1);
+        pages |= oledScroll.getPageMask(lineHeight * Variant::menuRows + GL_MENU_PADDING, height - 1);
+    }
+
+    // Row masks in scrolled viewport coordinates
+    pages |= getMenuRowPages(menuRenderer.getPreviousRenderIndex())
+            | getMenuRowPages(menuRenderer.getActiveRenderIndex());
+    renderMenuPages(pages);
+}
+
+/* Renders only display pages covering active menu row, used when value is edited inline */
+void renderMenuRow() {
+    renderMenuPages(getMenuRowPages(menuRenderer.getActiveRenderIndex()));
+}
+#endif
+
+/* Computes pulse high and low times from current frequency and pulse width */
+void updatePulseTiming() {
+    pulseHigh = toMicroseconds(settings.pulseWidth);
+    Microseconds period = periodOf(frequency);
+    pulseLow = period > pulseHigh ? period - pulseHigh : Microseconds();
+}
+
+/* Records fault if fault log is present in variant */
+void recordFault(byte code, word detail) {
+    #ifdef FAULT_LOG
+    faults.record(code, detail);
+
+    // First fault enables diagnostics item
+    if (faults.getTotal() == 1) {
+        menu.invalidate();
+    }
+    #else
+    (void) code;
+    (void) detail;
+    #endif
+}
+
+#ifdef UNITS_CHECKED
+/* Unit types arithmetic overflow handler */
+void unitsOverflow() {
+    recordFault(FAULT_UNITS_OVERFLOW, 0);
+}
+#endif
+
+/* Records fault if periodic task started later than tolerated */
+void checkTaskLate(unsigned long lastTime, word period) {
+    #ifdef FAULT_LOG
+    unsigned long lateness = millis() - lastTime - period;
+    if (lateness > FAULT_TASK_TOLERANCE) {
+        recordFault(FAULT_TASK_LATE, lateness);
+    }
+    #else
+    (void) lastTime;
+    (void) period;
+    #endif
+}
+
+/* Marks user activity for adaptive rate governor */
+void governorActivity() {
+    activityTime = millis();
+}
+
+/* Gets next refresh period, minimal while activity holds or doubled period up to maximum */
+word governPeriod(word period, word minimum, word maximum) {
+    if (millis() - activityTime < ACTIVITY_HOLD_PERIOD) {
+        return minimum;
+    }
+    return min(max(period, minimum) * 2, maximum);
+}
+
+/* Tags input event time, latency is measured till the next display frame flush */
+void inputTag() {
+    #ifdef SERIAL_LOG
+    if (!latencyPending) {
+        latencyPending = true;
+        latencyInputTime = micros();
+    }
+    #endif
+}
+
+/* Drops input tag if input caused no redraw, all screens except generator are flushed
+ * synchronously in input handlers */
+void inputSettled() {
+    #ifdef SERIAL_LOG
+    if (selected->getId() != MENU_GENERATOR) {
+        latencyPending = false;
+    }
+    #endif
+}
+
+/* Display frame has been flushed, records frame stall and latency of tagged input */
+void frameFlushed(byte screen, unsigned long frameStart) {
+    unsigned long frameTime = millis() - frameStart;
+    if (frameTime > FAULT_FRAME_STALL_TIME) {
+        recordFault(FAULT_FRAME_STALL, frameTime);
+    }
+
+    #ifdef SERIAL_LOG
+    if (latencyPending) {
+        latencyPending = false;
+        unsigned long latency = (micros() - latencyInputTime) / 1000;
+        byte bucket = 0;
+        while (latency > 0 && bucket < LATENCY_BUCKETS - 1) {
+            latency >>= 1;
+            bucket++;
+        }
+        latencyHistogram[screen][bucket]++;
+    }
+    #else
+    (void) screen;
+    #endif
 }
 
 /* Encoder rotation event */
 void encoderOnChange(RotaryEncoderOnChangeEvent event) {
+    governorActivity();
+    if (measureSettingsValue || selected->getId() != MENU_GENERATOR) {
+        inputTag();
+    }
+
     if (measureSettingsValue) {
         // Get direction: right = increase, left = decrease
         bool up = event.direction == right;
@@ -331,25 +1430,30 @@ void encoderOnChange(RotaryEncoderOnChangeEvent event) {
         // Measure setup value by selected item
         switch (selected->getId()) {
             case MENU_MIN_FREQ:
-                settings.minFreq = step(up, settings.minFreq, SETTINGS_MIN_FREQ_STEP,
-                        up ? SETTINGS_MIN_FREQ_MAX : SETTINGS_MIN_FREQ_MIN);
+                settings.minFreq = Hertz(step(up, settings.minFreq.value(), SETTINGS_MIN_FREQ_STEP,
+                        up ? SETTINGS_MIN_FREQ_MAX : SETTINGS_MIN_FREQ_MIN));
                 break;
 
             case MENU_MAX_FREQ:
-                settings.maxFreq = step(up, settings.maxFreq, SETTINGS_MAX_FREQ_STEP,
-                        up ? SETTINGS_MAX_FREQ_MAX : SETTINGS_MAX_FREQ_MIN);
+                settings.maxFreq = Hertz(step(up, settings.maxFreq.value(), SETTINGS_MAX_FREQ_STEP,
+                        up ? SETTINGS_MAX_FREQ_MAX : SETTINGS_MAX_FREQ_MIN));
                 break;
 
             case MENU_PULSE_WIDTH:
-                settings.pulseWidth = step(up, settings.pulseWidth, SETTINGS_PULSE_WIDTH_STEP,
-                        up ? SETTINGS_PULSE_WIDTH_MAX : SETTINGS_PULSE_WIDTH_MIN);
+                settings.pulseWidth = Milliseconds(step(up, settings.pulseWidth.value(),
+                        SETTINGS_PULSE_WIDTH_STEP, up ? SETTINGS_PULSE_WIDTH_MAX : SETTINGS_PULSE_WIDTH_MIN));
                 break;
 
             case MENU_FREQ_FLOATING:
-                // TODO change value and request render
+                settings.freqFloating = step(up, settings.freqFloating, SETTINGS_FREQ_FLOATING_STEP,
+                        up ? SETTINGS_FREQ_FLOATING_MAX : SETTINGS_FREQ_FLOATING_MIN);
                 break;
         }
-        renderMeasure();
+        if (menuRenderer.isEditing()) {
+            renderMenuRow();
+        } else {
+            renderMeasure();
+        }
     } else if (selected->getId() != MENU_GENERATOR) {
         // Move in menu
         if (event.direction == left) {
@@ -358,7 +1462,122 @@ void encoderOnChange(RotaryEncoderOnChangeEvent event) {
             menu.next();
         }
     }
+
+    inputSettled();
+}
+
+#ifdef SERIAL_LOG
+/* Prints screen type name */
+void printScreenName(byte screen) {
+    switch (screen) {
+        case SCREEN_SPLASH:
+            Serial.print("splash");
+            break;
+        case SCREEN_GENERATOR:
+            Serial.print("generator");
+            break;
+        case SCREEN_MENU:
+            Serial.print("menu");
+            break;
+        case SCREEN_MEASURE:
+            Serial.print("measure");
+            break;
+    }
+}
+
+/* Moves remote menu browser */
+void remoteNavigate(long action) {
+    switch (action) {
+        case REMOTE_MENU_NEXT:
+            remoteCursor.next();
+            break;
+        case REMOTE_MENU_PREV:
+            remoteCursor.prev();
+            break;
+        case REMOTE_MENU_ENTER:
+            remoteCursor.enter();
+            break;
+        case REMOTE_MENU_BACK:
+            remoteCursor.back();
+            break;
+        default:
+            remoteCursor.refresh();
+            remoteRenderer.render();
+    }
+}
+
+/* Remote browser moved, prints its viewport */
+void remoteActiveItemChanged(QMenuActiveItemChangedEvent) {
+    remoteRenderer.render();
+}
+
+/* Remote browser utilized item, browsing does not change settings */
+void remoteItemUtilized(QMenuItemUtilizedEvent event) {
+    Serial.print("m utilized ");
+    Serial.println(event.utilizedItem->getId());
+}
+
+/* Prints remote viewport line, active item is marked */
+void remoteRenderItem(QMenuRenderItemEvent event) {
+    Serial.print(event.isActive ? "m>" : "m ");
+    Serial.print(event.item->isEnabled() ? ' ' : '-');
+    Serial.print(event.item->getId());
+    Serial.print(' ');
+    Serial.println(event.item->getCaption());
+}
+
+/* Serial link command received */
+void serialOnCommand(SerialCommandEvent event) {
+    long count = event.hasArgument ? event.argument : 1;
+    switch (event.command) {
+        case 'r':
+        case 'l':
+            for (long index = 0; index < count; index++) {
+                RotaryEncoderOnChangeEvent change = { event.command == 'r' ? right : left, 0 };
+                encoderOnChange(change);
+            }
+            break;
+        case 'c':
+            encoderOnClick();
+            break;
+        case 'L':
+            encoderOnLongClick();
+            break;
+        case 'p':
+            freqInputOverride = event.hasArgument
+                    ? constrain(event.argument, FREQ_INPUT_MIN, FREQ_INPUT_MAX) : -1;
+            break;
+        case 'f':
+            Serial.print("f ");
+            Serial.println(frequency.value());
+            break;
+        case 's':
+            if (event.hasArgument) {
+                statusStreaming = event.argument != 0;
+            }
+            printStatus();
+            break;
+        case 'x':
+            stressStart(event.hasArgument ? event.argument : STRESS_SEED);
+            break;
+        case 'h':
+            printLatencyHistograms();
+            break;
+        #ifdef FAULT_LOG
+        case 'e':
+            if (event.hasArgument && event.argument == 0) {
+                faults.clear();
+                menu.invalidate();
+            }
+            printFaults();
+            break;
+        #endif
+        case 'm':
+            remoteNavigate(event.hasArgument ? event.argument : 0);
+            break;
+    }
 }
+#endif
 
 /* Change value by step in given direction */
 word step(bool up, word value, word step, word limit) {
@@ -371,25 +1590,53 @@ word step(bool up, word value, word step, word limit) {
 
 /* Encoder click event */
 void encoderOnClick() {
+    governorActivity();
+    inputTag();
+
     if (measureSettingsValue) {
         // Update measured value and escape measuring
         measureSettingsValue = false;
+        menuRenderer.setEditing(false);
         renderMenu();
     } else {
         // Menu click
         menu.enter();
     }
+
+    inputSettled();
 }
 
 /* Encoder long click event */
 void encoderOnLongClick() {
+    governorActivity();
+    if (measureSettingsValue || selected->getId() != MENU_GENERATOR) {
+        inputTag();
+    }
+
     if (measureSettingsValue) {
         // Discard measured value and escape measuring
         measureSettingsValue = false;
+        menuRenderer.setEditing(false);
         renderMenu();
     } else if (selected->getId() != MENU_GENERATOR) {
         // Get up in the menu
         menu.back();
+    } else {
+        // Pause or resume output on generator screen
+        setOutputPaused(!outputPaused);
+    }
+
+    inputSettled();
+}
+
+/* Pauses or resumes output, resumed output starts with full low period */
+void setOutputPaused(bool paused) {
+    if (paused == outputPaused) {
+        return;
+    }
+    outputPaused = paused;
+    if (!paused && pulseState == LOW) {
+        pulseLastTime = micros();
     }
 }
 
@@ -402,11 +1649,22 @@ void activeItemChanged(QMenuActiveItemChangedEvent event) {
         //Save settings when leaving menu or draw menu
         if (event.newActiveItem->getId() == MENU_GENERATOR) {
             saveSettings();
+            updatePulseTiming();
+            generatorDirty = true;
+            statusBarDrawn = STATUS_BAR_INVALID;
+            adLastRefresh = millis();
+            oledLastRefresh = millis();
             pulseState = LOW;
-            pulseLastTime = millis();
+            pulseLastTime = micros();
         } else {
             digitalWrite(PIN_OUTPUT, LOW);
-            renderMenu();
+
+            // Entering menu stops splash flow and restores contrast dimmed by its fade out
+            if (event.oldActiveItem == NULL || event.oldActiveItem->getId() == MENU_GENERATOR) {
+                splashFlow.stop();
+                oled.setContrast(OLED_CONTRAST);
+            }
+            renderMenuMove(event.oldActiveItem);
         }
     }
 }
@@ -419,6 +1677,8 @@ void onItemUtilized(QMenuItemUtilizedEvent event) {
         menu.toggleCheckable(event.utilizedItem);
         if (event.utilizedItem->getId() == MENU_USE_FILTER) {
             settings.useFilter = event.utilizedItem->isChecked(); 
+            menu.invalidate();
+            menu.refresh();
         }
         renderMenu();
     } else if (event.utilizedItem->isRadio()) {
@@ -443,11 +1703,22 @@ void onItemUtilized(QMenuItemUtilizedEvent event) {
         // Switch action via currently selected menu item
         switch (event.utilizedItem->getId()) {
 
-            // Setup item value measuring
+            // Setup item value measuring, inline in menu row if enabled in variant
             case MENU_MIN_FREQ:
             case MENU_MAX_FREQ:
             case MENU_PULSE_WIDTH:
             case MENU_FREQ_FLOATING:
+                measureSettingsValue = true;
+                if (Variant::inlineEdit) {
+                    menuRenderer.setEditing(true);
+                    renderMenu();
+                } else {
+                    renderMeasure();
+                }
+                break;
+
+            // Diagnostics are shown on measure screen
+            case MENU_DIAGNOSTICS:
                 measureSettingsValue = true;
                 renderMeasure();
                 break;
@@ -455,6 +1726,34 @@ void onItemUtilized(QMenuItemUtilizedEvent event) {
     }
 }
 
+/* Conditional menu items visibility, frequency floating is shown only when smooth filter
+ * does not flatten it */
+bool isMenuItemVisible(const QMenuItem* item) {
+    switch (item->getId()) {
+        case MENU_FREQ_FLOATING:
+            return !(Variant::filter && settings.useFilter);
+    }
+    return true;
+}
+
+/* Conditional menu items enable state, diagnostics is enabled when any fault is recorded */
+bool isMenuItemEnabled(const QMenuItem* item) {
+    switch (item->getId()) {
+        #ifdef FAULT_LOG
+        case MENU_DIAGNOSTICS:
+            return faults.getTotal() > 0;
+        #endif
+    }
+    return true;
+}
+
+/* Sets menu caption font and gets menu row height */
+u8g_uint_t getMenuLineHeight() {
+    oled.setFont(u8g_font_6x13);
+    oled.setFontRefHeightText();
+    return oled.getFontAscent() - oled.getFontDescent() + GL_MENU_PADDING;
+}
+
 /* Render menu item */
 void onRenderMenuItem(QMenuRenderItemEvent event) {
     // Item icon
@@ -467,22 +1766,38 @@ void onRenderMenuItem(QMenuRenderItemEvent event) {
         strcpy(icon, event.item->isChecked() ? "\x23" : "\x21");   
     }
 
-    // Setup font for menu caption
-    oled.setFont(u8g_font_6x13);
-    oled.setFontRefHeightText();
+    // Setup font for menu caption, row is shifted when scrolled
+    u8g_uint_t lineHeight = getMenuLineHeight();
+    u8g_uint_t top = lineHeight * event.renderIndex + menuOffsetY;
     oled.setFontPosTop();
     oled.setDefaultForegroundColor();
-    u8g_uint_t lineHeight = oled.getFontAscent() - oled.getFontDescent() + GL_MENU_PADDING;
 
     // If drawing selected item, draw bar and set bg color
     if (event.isActive) {
-        oled.drawBox(0, lineHeight * event.renderIndex, oled.getWidth(), lineHeight + GL_MENU_PADDING);
+        oled.drawBox(0, top, oled.getWidth(), lineHeight + GL_MENU_PADDING);
         oled.setDefaultBackgroundColor();
     }
-    oled.drawStr(GL_MENU_PADDING, lineHeight * event.renderIndex + GL_MENU_PADDING, event.item->getCaption());
+    oled.drawStr(GL_MENU_PADDING, top + GL_MENU_PADDING, event.item->getCaption());
+
+    // Strike disabled item through
+    if (!event.item->isEnabled()) {
+        oled.drawHLine(GL_MENU_PADDING, top + lineHeight / 2 + GL_MENU_PADDING,
+                oled.getWidth() - 2 * GL_MENU_PADDING);
+    }
+
+    // Draw edited value in field at the right edge instead of icon
+    if (event.isEditing) {
+        char value[32] = "";
+        getSettingsText(event.item->getId(), value);
+        u8g_uint_t fieldWidth = oled.getStrWidth(value) + 2 * GL_MENU_PADDING;
+        u8g_uint_t fieldLeft = oled.getWidth() - fieldWidth - GL_MENU_PADDING;
+        oled.setDefaultBackgroundColor();
+        oled.drawBox(fieldLeft, top + GL_MENU_PADDING, fieldWidth, lineHeight - GL_MENU_PADDING);
+        oled.setDefaultForegroundColor();
+        oled.drawStr(fieldLeft + GL_MENU_PADDING, top + GL_MENU_PADDING, value);
 
     // Draw item's icon
-    if (strlen(icon) > 0) {
+    } else if (strlen(icon) > 0) {
         oled.setFont(u8g_font_8x13_75r);
         oled.setFontPosTop();
         u8g_uint_t iconWidth = oled.getStrWidth(icon);
@@ -491,10 +1806,81 @@ void onRenderMenuItem(QMenuRenderItemEvent event) {
         } else {
             oled.setDefaultForegroundColor();
         }
-        oled.drawStr(oled.getWidth() - iconWidth - GL_MENU_PADDING, lineHeight * event.renderIndex, icon);
+        oled.drawStr(oled.getWidth() - iconWidth - GL_MENU_PADDING, top, icon);
     }
 }
 
+#ifdef MENU_GRID
+/* Gets grid menu icon of item, items showing settings use status bar icons */
+const uint8_t* getMenuIcon(const QMenuItem* item) {
+    switch (item->getId()) {
+        case MENU_MIN_FREQ:
+            return menuIconMinFreq;
+        case MENU_MAX_FREQ:
+            return menuIconMaxFreq;
+        case MENU_PULSE_WIDTH:
+            return menuIconPulseWidth;
+        case MENU_CURVE_SHAPE_SUBMENU:
+        case MENU_CURVE_SHAPE_QUADRATIC:
+            return statusIconCurveQuadratic;
+        case MENU_CURVE_SHAPE_LINEAR:
+            return statusIconCurveLinear;
+        case MENU_FREQ_FLOATING:
+            return menuIconFreqFloating;
+        case MENU_FREQ_UNITS_SUBMENU:
+        case MENU_FREQ_UNITS_HZ:
+            return statusIconModeHz;
+        case MENU_FREQ_UNITS_RPM:
+            return statusIconModeRpm;
+        case MENU_USE_FILTER:
+            return item->isChecked() ? statusIconFilterOn : statusIconFilterOff;
+        case MENU_DIAGNOSTICS:
+            return statusIconFault;
+    }
+    return menuIconBack;
+}
+
+/* Draws grid menu item icon to its cell, active item is framed and its caption or edited value
+ * is drawn to caption line, cells are shifted by menuOffsetY as menu rows */
+void onRenderMenuGridItem(QMenuRenderItemEvent event) {
+    QMenuGridCell cell = menuRenderer.getCell(event.renderIndex);
+    u8g_uint_t top = cell.top + menuOffsetY;
+    u8g_uint_t iconLeft = cell.left + u8gCenter(cell.width, STATUS_ICON_SIZE);
+    u8g_uint_t iconTop = top + u8gCenter(cell.height, STATUS_ICON_SIZE);
+    oled.setDefaultForegroundColor();
+
+    if (event.isActive) {
+        oled.drawFrame(cell.left + GL_MENU_PADDING, top + GL_MENU_PADDING,
+                cell.width - 2 * GL_MENU_PADDING, cell.height - 2 * GL_MENU_PADDING);
+    }
+    oled.drawBitmapP(iconLeft, iconTop, 1, STATUS_ICON_SIZE, getMenuIcon(event.item));
+
+    // Underline checked radio item, strike disabled item through
+    if (event.item->isRadio() && event.item->isChecked()) {
+        oled.drawHLine(iconLeft, iconTop + STATUS_ICON_SIZE + GL_MENU_PADDING, STATUS_ICON_SIZE);
+    }
+    if (!event.item->isEnabled()) {
+        oled.drawHLine(iconLeft - GL_MENU_PADDING, iconTop + STATUS_ICON_SIZE / 2,
+                STATUS_ICON_SIZE + 2 * GL_MENU_PADDING);
+    }
+
+    if (event.isActive) {
+        QMenuGridCell caption = menuRenderer.getCaption();
+        u8g_uint_t captionTop = caption.top + menuOffsetY;
+        oled.setFont(u8g_font_6x13);
+        oled.setFontPosTop();
+        oled.drawHLine(0, captionTop, caption.width);
+        if (event.isEditing) {
+            char value[32] = "";
+            getSettingsText(event.item->getId(), value);
+            oled.drawStr(GL_MENU_PADDING, captionTop + GL_MENU_PADDING, value);
+        } else {
+            oled.drawStr(GL_MENU_PADDING, captionTop + GL_MENU_PADDING, event.item->getCaption());
+        }
+    }
+}
+#endif
+
 /* Center object to range */
 u8g_uint_t u8gCenter(u8g_uint_t range, u8g_uint_t size) {
     return (range - size) / 2;
@@ -521,20 +1907,88 @@ void loadSettings() {
     } 
 }
 
-/* Stores settings into EEPROM */
-void saveSettings() { 
+/* Stores settings into EEPROM, only changed bytes are written */
+void saveSettings() {
+    #ifdef SERIAL_LOG
+    // Settings changed by input storm are restored when it finishes
+    if (stressIndex < STRESS_EVENTS) {
+        return;
+    }
+    #endif
+
+    unsigned long saveStart = millis();
+    #ifdef BENCHMARK
+    unsigned long start = micros();
+    byte written = 0;
+    #endif
+
     for (unsigned int index = 0; index < sizeof(settings); index++) {
-        EEPROM.update(SETTINGS_EEPROM_ADDRESS + index, *((char *)&settings + index));
+        byte value = *((char *)&settings + index);
+        if (EEPROM.read(SETTINGS_EEPROM_ADDRESS + index) != value) {
+            EEPROM.write(SETTINGS_EEPROM_ADDRESS + index, value);
+            #ifdef BENCHMARK
+            benchmarkEepromWrites[index]++;
+            written++;
+            #endif
+        }
+    }
+
+    #ifdef BENCHMARK
+    benchmarkEepromSave(written, micros() - start);
+    #endif
+
+    unsigned long saveTime = millis() - saveStart;
+    if (saveTime > FAULT_EEPROM_STALL_TIME) {
+        recordFault(FAULT_EEPROM_STALL, saveTime);
+    }
+}
+
+/* Applies smooth filter to A/D value and returns filtered value */
+int filterFrequencyInput(int value) {
+    int scaled = value << FREQ_FILTER_FRACTION_BITS;
+    if (freqFiltered < 0) {
+        freqFiltered = scaled;
+    } else {
+        freqFiltered += (scaled - freqFiltered) >> FREQ_FILTER_SHIFT;
     }
+    return (freqFiltered + (1 << (FREQ_FILTER_FRACTION_BITS - 1))) >> FREQ_FILTER_FRACTION_BITS;
 }
 
 /* Calucates frequency from min and max value and A/D current value */
-word readFrequnecyValue() {
-    int value = analogRead(FREQ_PIN);
+Hertz readFrequnecyValue() {
+    PROFILE_BUDGET("readFrequnecyValue", BUDGET_FREQ_READ_CYCLES);
+
+    int value;
+    {
+        PROFILE("analogRead");
+        value = analogRead(FREQ_PIN);
+    }
+
+    #ifdef SERIAL_LOG
+    if (freqInputOverride >= 0) {
+        value = freqInputOverride;
+    }
+    #endif
+
+    // Potentiometer movement speeds up sampling and refresh
+    if (freqInputLast < 0 || abs(value - freqInputLast) > ACTIVITY_AD_THRESHOLD) {
+        governorActivity();
+        freqInputLast = value;
+    }
+
+    // Smooth potentiometer noise
+    if (Variant::filter && settings.useFilter) {
+        value = filterFrequencyInput(value);
+    } else {
+        freqFiltered = -1;
+    }
+
+    PROFILE("map");
     if (settings.accelerationCurve == ACCELERATION_SHAPE_QUADRATIC) {
         // TODO Fix quad calculation error
         word quad = value * value;
         value = map(quad, 0, 1048575, FREQ_INPUT_MIN, FREQ_INPUT_MAX);
     }
-    return map(value, FREQ_INPUT_MIN, FREQ_INPUT_MAX, settings.minFreq, settings.maxFreq);
+    return Hertz(map(value, FREQ_INPUT_MIN, FREQ_INPUT_MAX, settings.minFreq.value(),
+            settings.maxFreq.value()));
 }
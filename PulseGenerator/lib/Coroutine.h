@@ -0,0 +1,140 @@
+/**
+ * @brief Stackless coroutines (protothreads) for non-blocking sequential flows.
+ *
+ * Coroutine body is a function taking Coroutine reference and returning true when the flow has
+ * finished. Body is written between COROUTINE_BEGIN and COROUTINE_END and is resumed from the
+ * last yield or wait point on every call. Local variables are not preserved between calls, keep
+ * flow state in globals or members. Switch statements must not be used inside body directly.
+ *
+ * Example:
+ *      bool blink(Coroutine &co) {
+ *          COROUTINE_BEGIN(co);
+ *          digitalWrite(LED, HIGH);
+ *          COROUTINE_DELAY(co, 500);
+ *          digitalWrite(LED, LOW);
+ *          COROUTINE_END(co);
+ *      }
+ *
+ * @author https://github.com/Konajka
+ * @version 0.1 2026-10-18
+ *      Base implementation.
+ * @version 0.2 2026-10-18
+ *      Coroutine state is private, macros use accessors.
+ */
+
+#ifndef COROUTINE_H
+#define COROUTINE_H
+
+#include <Arduino.h>
+
+// Finished coroutine resume point
+#define COROUTINE_FINISHED 0xFFFF
+
+/**
+ * @brief Coroutine state.
+ */
+class Coroutine
+{
+    private:
+        // Resume point, source line of last yield or 0 for start
+        word _line = COROUTINE_FINISHED;
+
+        // Wait start time for COROUTINE_DELAY
+        unsigned long _waitStart;
+
+    public:
+
+        /**
+         * @brief Restarts coroutine from the beginning on next call.
+         */
+        void start() {
+            _line = 0;
+        }
+
+        /**
+         * @brief Stops coroutine, next call finishes immediately.
+         */
+        void stop() {
+            _line = COROUTINE_FINISHED;
+        }
+
+        /**
+         * @brief Gets if coroutine has been started and has not finished yet.
+         * @return Returns true if coroutine is running.
+         */
+        bool isRunning() {
+            return _line != COROUTINE_FINISHED;
+        }
+
+        /**
+         * @brief Gets resume point, used by COROUTINE_BEGIN.
+         * @return Returns source line of last yield, 0 for start or COROUTINE_FINISHED.
+         */
+        word getResumePoint() {
+            return _line;
+        }
+
+        /**
+         * @brief Sets resume point, used by yield and wait macros.
+         * @param line Source line to resume at.
+         */
+        void setResumePoint(word line) {
+            _line = line;
+        }
+
+        /**
+         * @brief Starts measuring delay, used by COROUTINE_DELAY.
+         */
+        void startDelay() {
+            _waitStart = millis();
+        }
+
+        /**
+         * @brief Gets if delay has elapsed since startDelay(), used by COROUTINE_DELAY.
+         * @param ms Delay in ms.
+         * @return Returns true if delay has elapsed.
+         */
+        bool isDelayElapsed(unsigned long ms) {
+            return millis() - _waitStart >= ms;
+        }
+};
+
+/* Starts coroutine body */
+#define COROUTINE_BEGIN(co) \
+    switch ((co).getResumePoint()) { \
+        case COROUTINE_FINISHED: \
+            return true; \
+        case 0:
+
+/* Suspends coroutine, next call resumes after this point */
+#define COROUTINE_YIELD(co) \
+    do { \
+        (co).setResumePoint(__LINE__); \
+        return false; \
+        case __LINE__:; \
+    } while (0)
+
+/* Suspends coroutine until condition is true */
+#define COROUTINE_WAIT_UNTIL(co, condition) \
+    do { \
+        (co).setResumePoint(__LINE__); \
+        case __LINE__: \
+        if (!(condition)) { \
+            return false; \
+        } \
+    } while (0)
+
+/* Suspends coroutine for given time in ms */
+#define COROUTINE_DELAY(co, ms) \
+    do { \
+        (co).startDelay(); \
+        COROUTINE_WAIT_UNTIL(co, (co).isDelayElapsed(ms)); \
+    } while (0)
+
+/* Ends coroutine body, coroutine is finished */
+#define COROUTINE_END(co) \
+    } \
+    (co).stop(); \
+    return true
+
+#endif
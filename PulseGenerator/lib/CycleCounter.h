@@ -0,0 +1,92 @@
+/**
+ * @brief Exact CPU cycle counter based on free running Timer1.
+ *
+ * Timer1 runs without prescaler, so every timer tick is exactly one CPU cycle. Timer overflows
+ * are counted in interrupt to extend counter to 32 bits (about 268 s at 16 MHz). Differences of
+ * two readings are valid across counter wrap when computed as unsigned long.
+ *
+ * Note: Timer1 is exclusively used by this counter, so PWM on pins 9 and 10 and libraries using
+ * Timer1 are not available when the counter runs.
+ *
+ * @author https://github.com/Konajka
+ * @version 0.1 2026-10-18
+ *      Base implementation.
+ */
+
+#ifndef CYCLE_COUNTER_H
+#define CYCLE_COUNTER_H
+
+#include <Arduino.h>
+
+// Number of CPU cycles in one microsecond
+#define CYCLE_COUNTER_CYCLES_PER_MICRO (F_CPU / 1000000UL)
+
+// Timer1 overflows counter, high word of cycle counter
+volatile word _cycleCounterOverflows = 0;
+
+ISR(TIMER1_OVF_vect) {
+    _cycleCounterOverflows++;
+}
+
+/**
+ * @brief Cycle counter controller class. All methods are static, counter is singleton.
+ */
+class CycleCounter
+{
+    public:
+
+        /**
+         * @brief Starts Timer1 as free running counter without prescaler. Call this once in
+         * `setup()` before first measuring.
+         */
+        static void begin() {
+            uint8_t sreg = SREG;
+            cli();
+            TCCR1A = 0;
+            TCCR1B = _BV(CS10);
+            TCNT1 = 0;
+            _cycleCounterOverflows = 0;
+            TIFR1 = _BV(TOV1);
+            TIMSK1 = _BV(TOIE1);
+            SREG = sreg;
+        }
+
+        /**
+         * @brief Gets current cycle counter value.
+         * @return Returns number of CPU cycles since `begin()` modulo 2^32.
+         */
+        static unsigned long now() {
+            uint8_t sreg = SREG;
+            cli();
+            word low = TCNT1;
+            word high = _cycleCounterOverflows;
+
+            // Overflow occured while interrupts are disabled and is not counted yet
+            if ((TIFR1 & _BV(TOV1)) && low < 0x8000) {
+                high++;
+            }
+            SREG = sreg;
+
+            return ((unsigned long) high << 16) | low;
+        }
+
+        /**
+         * @brief Gets number of cycles elapsed since given counter value.
+         * @param since Counter value returned by `now()`.
+         * @return Returns number of CPU cycles elapsed.
+         */
+        static unsigned long elapsed(unsigned long since) {
+            return now() - since;
+        }
+
+        /**
+         * @brief Converts CPU cycles to microseconds.
+         * @param cycles Number of CPU cycles.
+         * @return Returns cycles duration in microseconds.
+         */
+        static unsigned long toMicros(unsigned long cycles) {
+            return cycles / CYCLE_COUNTER_CYCLES_PER_MICRO;
+        }
+};
+
+#endif
@@ -14,33 +14,42 @@
 #define MENU_FREQ_UNITS_RPM 161
 #define MENU_FREQ_UNITS_HZ 162
 #define MENU_USE_FILTER 17
+#define MENU_DIAGNOSTICS 18
 #define MENU_BACK 0
 
+/* Number of menu items created by populateMenu() in the richest variant, including root */
+#define MENU_ITEM_COUNT 16
+
 #define ACCELERATION_SHAPE_LINEAR 0
 #define ACCELERATION_SHAPE_QUADRATIC 1
 
 #define FREQ_UNITS_RPM 0
 #define FREQ_UNITS_HZ 1
 
-/* Create menu structure */
+/* Create menu structure, optional items are present by variant */
 void populateMenu(QMenu& menu) {
-    menu.getRoot()
-        ->setMenu(QMenuItem::create(MENU_MIN_FREQ, "Minimal frequency"))
-        ->setNext(QMenuItem::create(MENU_MAX_FREQ, "Maximal frequency"))
-        ->setNext(QMenuItem::create(MENU_PULSE_WIDTH, "Pulse width"))
-        ->setNext(QMenuItem::create(MENU_CURVE_SHAPE_SUBMENU, "Acceleration curve"))
-            ->setMenu(QMenuItem::createRadio(MENU_CURVE_SHAPE_LINEAR, "Linear curve", MENU_CURVE_SHAPE_SUBMENU, true))
-            ->setNext(QMenuItem::createRadio(MENU_CURVE_SHAPE_QUADRATIC, "Quadratic curve", MENU_CURVE_SHAPE_SUBMENU, false))
-            ->setNext(QMenuItem::create(MENU_BACK, "Back"))
-            ->getBack()
-        //->setNext(QMenuItem::create(MENU_FREQ_FLOATING, "Frequency floating"))
-        ->setNext(QMenuItem::create(MENU_FREQ_UNITS_SUBMENU, "Frequency units"))
-            ->setMenu(QMenuItem::createRadio(MENU_FREQ_UNITS_RPM, "Rotates per minute", MENU_FREQ_UNITS_SUBMENU, true))
-            ->setNext(QMenuItem::createRadio(MENU_FREQ_UNITS_HZ, "Hertz", MENU_FREQ_UNITS_SUBMENU, false))
-            ->setNext(QMenuItem::create(MENU_BACK, "Back"))
+    QMenuItem* item = menu.getRoot()
+        ->setMenu(QMenuItem::create(MENU_MIN_FREQ, F("Minimal frequency")))
+        ->setNext(QMenuItem::create(MENU_MAX_FREQ, F("Maximal frequency")))
+        ->setNext(QMenuItem::create(MENU_PULSE_WIDTH, F("Pulse width")))
+        ->setNext(QMenuItem::create(MENU_CURVE_SHAPE_SUBMENU, F("Acceleration curve")))
+            ->setMenu(QMenuItem::createRadio(MENU_CURVE_SHAPE_LINEAR, F("Linear curve"), MENU_CURVE_SHAPE_SUBMENU, true))
+            ->setNext(QMenuItem::createRadio(MENU_CURVE_SHAPE_QUADRATIC, F("Quadratic curve"), MENU_CURVE_SHAPE_SUBMENU, false))
+            ->setNext(QMenuItem::create(MENU_BACK, F("Back")))
             ->getBack()
-        ->setNext(QMenuItem::createCheckable(MENU_USE_FILTER, "Use smooth filter", true))
-        ->setNext(QMenuItem::create(MENU_BACK, "Back"));
+        ->setNext(QMenuItem::createConditional(MENU_FREQ_FLOATING, F("Frequency floating")))
+        ->setNext(QMenuItem::create(MENU_FREQ_UNITS_SUBMENU, F("Frequency units")))
+            ->setMenu(QMenuItem::createRadio(MENU_FREQ_UNITS_RPM, F("Rotates per minute"), MENU_FREQ_UNITS_SUBMENU, true))
+            ->setNext(QMenuItem::createRadio(MENU_FREQ_UNITS_HZ, F("Hertz"), MENU_FREQ_UNITS_SUBMENU, false))
+            ->setNext(QMenuItem::create(MENU_BACK, F("Back")))
+            ->getBack();
+    if (Variant::filter) {
+        item = item->setNext(QMenuItem::createCheckable(MENU_USE_FILTER, F("Use smooth filter"), true));
+    }
+    #ifdef FAULT_LOG
+    item = item->setNext(QMenuItem::createConditional(MENU_DIAGNOSTICS, F("Diagnostics")));
+    #endif
+    item->setNext(QMenuItem::create(MENU_BACK, F("Back")));
 }
 
 /* Application settings */
@@ -56,12 +65,15 @@ void populateMenu(QMenu& menu) {
 #define SETTINGS_PULSE_WIDTH_MIN 1
 #define SETTINGS_PULSE_WIDTH_MAX 5
 #define SETTINGS_PULSE_WIDTH_STEP 1
+#define SETTINGS_FREQ_FLOATING_MIN 0
+#define SETTINGS_FREQ_FLOATING_MAX 20
+#define SETTINGS_FREQ_FLOATING_STEP 5
 
 typedef struct Settings {
     char header[5];
-    word minFreq;
-    word maxFreq;
-    byte pulseWidth;
+    Hertz minFreq;
+    Hertz maxFreq;
+    Milliseconds pulseWidth;
     byte accelerationCurve;
     byte freqFloating;
     byte freqUnits;
@@ -69,17 +81,20 @@ typedef struct Settings {
 } ;
 
 /* Returns current frequency level in requested units */
-word getFreqByUnits(Settings settings, word freq) {
-    return settings.freqUnits == FREQ_UNITS_RPM ? freq * 60 : freq;
+word getFreqByUnits(Settings settings, Hertz freq) {
+    return settings.freqUnits == FREQ_UNITS_RPM ? toRpm(freq).value() : freq.value();
 }
 
 /* Propagates settings structure to menu state */
 void propagateSettingsToMenu(Settings settings, QMenu &menu) {
-    menu.find(MENU_USE_FILTER, true)->setChecked(settings.useFilter);
+    if (Variant::filter) {
+        menu.find(MENU_USE_FILTER, true)->setChecked(settings.useFilter);
+    }
     menu.switchRadio(menu.find(settings.accelerationCurve == ACCELERATION_SHAPE_LINEAR
             ? MENU_CURVE_SHAPE_LINEAR : MENU_CURVE_SHAPE_QUADRATIC, true));
     menu.switchRadio(menu.find(settings.freqUnits == FREQ_UNITS_RPM
             ? MENU_FREQ_UNITS_RPM : MENU_FREQ_UNITS_HZ, true));
+    menu.invalidate();
 }
 
 /* Gets current units name */
@@ -0,0 +1,131 @@
+/**
+ * @brief Small RAM ring of time-stamped fault events with per-code counters.
+ *
+ * Newest entries overwrite oldest ones when ring is full, counters keep counting (saturated at
+ * 65535) so they report all faults since last clear.
+ *
+ * @author https://github.com/Konajka
+ * @version 0.1 2026-10-18
+ *      Base implementation.
+ */
+
+#ifndef FAULT_LOG_H
+#define FAULT_LOG_H
+
+#include <Arduino.h>
+
+// Number of entries kept in ring
+#ifndef FAULT_LOG_SIZE
+#define FAULT_LOG_SIZE 8
+#endif
+
+// Number of distinct fault codes, codes are 0 to FAULT_LOG_CODES - 1
+#ifndef FAULT_LOG_CODES
+#define FAULT_LOG_CODES 4
+#endif
+
+/* Fault ring entry */
+struct FaultLogEntry {
+    byte code;
+    word detail;
+    unsigned long time;
+};
+
+/**
+ * @brief Fault log class.
+ */
+class FaultLog
+{
+    private:
+        // Ring of entries, _head is index of next entry written
+        FaultLogEntry _entries[FAULT_LOG_SIZE];
+        byte _head = 0;
+        byte _size = 0;
+
+        // Counters
+        word _counts[FAULT_LOG_CODES];
+        word _total = 0;
+
+    public:
+
+        /**
+         * @brief Creates empty fault log.
+         */
+        FaultLog() {
+            clear();
+        }
+
+        /**
+         * @brief Records fault with current millis() time stamp.
+         * @param code Fault code, values out of range are ignored.
+         * @param detail Fault specific detail, e.g. lateness in ms.
+         */
+        void record(byte code, word detail) {
+            if (code >= FAULT_LOG_CODES) {
+                return;
+            }
+
+            FaultLogEntry &entry = _entries[_head];
+            entry.code = code;
+            entry.detail = detail;
+            entry.time = millis();
+            _head = (_head + 1) % FAULT_LOG_SIZE;
+            if (_size < FAULT_LOG_SIZE) {
+                _size++;
+            }
+
+            if (_counts[code] < 0xFFFF) {
+                _counts[code]++;
+            }
+            if (_total < 0xFFFF) {
+                _total++;
+            }
+        }
+
+        /**
+         * @brief Gets number of faults with given code since last clear.
+         */
+        word getCount(byte code) {
+            return code < FAULT_LOG_CODES ? _counts[code] : 0;
+        }
+
+        /**
+         * @brief Gets number of all faults since last clear.
+         */
+        word getTotal() {
+            return _total;
+        }
+
+        /**
+         * @brief Gets number of entries in ring.
+         */
+        byte getSize() {
+            return _size;
+        }
+
+        /**
+         * @brief Gets ring entry.
+         * @param index Zero based entry index, 0 is the newest entry.
+         * @return Returns entry reference or NULL if index is out of ring size.
+         */
+        const FaultLogEntry* get(byte index) {
+            if (index >= _size) {
+                return NULL;
+            }
+            return &_entries[(_head + FAULT_LOG_SIZE - 1 - index) % FAULT_LOG_SIZE];
+        }
+
+        /**
+         * @brief Clears ring and counters.
+         */
+        void clear() {
+            _head = 0;
+            _size = 0;
+            _total = 0;
+            for (byte code = 0; code < FAULT_LOG_CODES; code++) {
+                _counts[code] = 0;
+            }
+        }
+};
+
+#endif
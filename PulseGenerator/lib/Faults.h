@@ -0,0 +1,51 @@
+/**
+ * @brief Fault codes recorded to fault log and their names.
+ *
+ * @author https://github.com/Konajka
+ * @version 0.1 2026-10-18
+ *      Base implementation.
+ */
+
+#ifndef FAULTS_H
+#define FAULTS_H
+
+#include <Arduino.h>
+
+/* Fault codes */
+#define FAULT_TASK_LATE 0
+#define FAULT_PULSE_LATE 1
+#define FAULT_SERIAL_OVERFLOW 2
+#define FAULT_EEPROM_STALL 3
+#define FAULT_UNITS_OVERFLOW 4
+#define FAULT_FRAME_STALL 5
+
+/* Number of fault codes, see FaultLog.h */
+#define FAULT_LOG_CODES 6
+
+/* Gets fault name */
+void getFaultName(byte code, char* buffer) {
+    switch (code) {
+        case FAULT_TASK_LATE:
+            strcpy(buffer, "task late");
+            break;
+        case FAULT_PULSE_LATE:
+            strcpy(buffer, "pulse late");
+            break;
+        case FAULT_SERIAL_OVERFLOW:
+            strcpy(buffer, "serial overflow");
+            break;
+        case FAULT_EEPROM_STALL:
+            strcpy(buffer, "eeprom stall");
+            break;
+        case FAULT_UNITS_OVERFLOW:
+            strcpy(buffer, "units overflow");
+            break;
+        case FAULT_FRAME_STALL:
+            strcpy(buffer, "frame stall");
+            break;
+        default:
+            strcpy(buffer, "");
+    }
+}
+
+#endif
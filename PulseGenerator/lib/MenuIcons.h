@@ -0,0 +1,43 @@
+/**
+ * @brief Pre-rasterized grid menu icons in program memory.
+ *
+ * Icons have the same 8x8 format as status bar icons (see StatusIcons.h), menu items showing
+ * the same setting as status bar reuse status bar icons.
+ *
+ * @author https://github.com/Konajka
+ * @version 0.1 2026-10-18
+ *      Base implementation.
+ */
+
+#ifndef MENU_ICONS_H
+#define MENU_ICONS_H
+
+#include <Arduino.h>
+#include "StatusIcons.h"
+
+/* Minimal frequency, arrow down to bar */
+const uint8_t menuIconMinFreq[STATUS_ICON_SIZE] PROGMEM = {
+    0x10, 0x10, 0x10, 0x7C, 0x38, 0x10, 0xFE, 0x00
+};
+
+/* Maximal frequency, arrow up to bar */
+const uint8_t menuIconMaxFreq[STATUS_ICON_SIZE] PROGMEM = {
+    0xFE, 0x10, 0x38, 0x7C, 0x10, 0x10, 0x10, 0x00
+};
+
+/* Pulse width, single pulse */
+const uint8_t menuIconPulseWidth[STATUS_ICON_SIZE] PROGMEM = {
+    0x00, 0x3C, 0x24, 0x24, 0x24, 0x24, 0xE7, 0x00
+};
+
+/* Frequency floating, waves */
+const uint8_t menuIconFreqFloating[STATUS_ICON_SIZE] PROGMEM = {
+    0x00, 0x60, 0x92, 0x0C, 0x60, 0x92, 0x0C, 0x00
+};
+
+/* Back, arrow left */
+const uint8_t menuIconBack[STATUS_ICON_SIZE] PROGMEM = {
+    0x00, 0x20, 0x60, 0xFE, 0x60, 0x20, 0x00, 0x00
+};
+
+#endif
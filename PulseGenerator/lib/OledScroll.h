@@ -0,0 +1,180 @@
+/**
+ * @brief SSD1306 hardware vertical scrolling via display start line register.
+ *
+ * Display RAM is used as ring buffer, screen line y shows RAM line (y + start line) mod 64.
+ * Scrolling changes only the start line, so content already in display RAM moves without bus
+ * transfer and only newly exposed lines have to be rendered.
+ *
+ * Partial frames are rendered by page loop limited to RAM pages in page mask. Scene has to be
+ * drawn OLED_SCROLL_COPIES times per page, shifted by getOffset() of each copy, so lines wrapped
+ * around the end of RAM are drawn too. U8glib coordinates are 8-bit and wrap, so shifted scene
+ * is clipped correctly.
+ *
+ * Example:
+ *      scroll.scroll(rowHeight);
+ *      if (scroll.firstPage(scroll.getPageMask(top, bottom))) {
+ *          do {
+ *              for (byte copy = 0; copy < OLED_SCROLL_COPIES; copy++) {
+ *                  drawScene(scroll.getOffset(copy));
+ *              }
+ *          } while (scroll.nextPage());
+ *      }
+ *
+ * @author https://github.com/Konajka
+ * @version 0.1 2026-10-18
+ *      Base implementation.
+ */
+
+#ifndef OLED_SCROLL_H
+#define OLED_SCROLL_H
+
+#include <Arduino.h>
+#include "U8glib.h"
+
+// Display RAM height and pages
+#define OLED_SCROLL_HEIGHT 64
+#define OLED_SCROLL_PAGES 8
+
+// Scene copies drawn per page
+#define OLED_SCROLL_COPIES 2
+
+// SSD1306 set display start line command
+#define OLED_SCROLL_CMD_START_LINE 0x40
+
+/**
+ * @brief OLED scroll class.
+ */
+class OledScroll
+{
+    private:
+        U8GLIB* _oled;
+        byte _startLine = 0;
+        byte _pageMask = 0;
+
+        /**
+         * @brief Gets page buffer of display.
+         */
+        u8g_pb_t* getPageBuffer() {
+            return (u8g_pb_t*) _oled->getU8g()->dev->dev_mem;
+        }
+
+        /**
+         * @brief Moves page loop to given page. Page buffer has to be cleared.
+         */
+        void setPage(byte page) {
+            u8g_t* u8g = _oled->getU8g();
+            u8g_pb_t* pb = getPageBuffer();
+            pb->p.page = page;
+            pb->p.page_y0 = page * pb->p.page_height;
+            pb->p.page_y1 = pb->p.page_y0 + pb->p.page_height - 1;
+            u8g_call_dev_fn(u8g, u8g->dev, U8G_DEV_MSG_GET_PAGE_BOX, &u8g->current_page);
+        }
+
+        /**
+         * @brief Moves page loop to first page in mask from given page.
+         * @return Returns true if page loop has been moved or false if there is no such page.
+         */
+        bool seekPage(byte page) {
+            while (page < OLED_SCROLL_PAGES && !(_pageMask & (1 << page))) {
+                page++;
+            }
+            if (page >= OLED_SCROLL_PAGES) {
+                return false;
+            }
+            setPage(page);
+            return true;
+        }
+
+    public:
+
+        /**
+         * @brief Creates new instance with start line 0.
+         * @param oled SSD1306 display.
+         */
+        OledScroll(U8GLIB* oled) {
+            _oled = oled;
+        }
+
+        /**
+         * @brief Gets current display start line.
+         */
+        byte getStartLine() {
+            return _startLine;
+        }
+
+        /**
+         * @brief Sets display start line.
+         * @param line RAM line shown on the first screen line.
+         */
+        void setStartLine(byte line) {
+            u8g_t* u8g = _oled->getU8g();
+            _startLine = line & (OLED_SCROLL_HEIGHT - 1);
+            u8g_SetChipSelect(u8g, u8g->dev, 1);
+            u8g_SetAddress(u8g, u8g->dev, 0);
+            u8g_WriteByte(u8g, u8g->dev, OLED_SCROLL_CMD_START_LINE | _startLine);
+            u8g_SetChipSelect(u8g, u8g->dev, 0);
+        }
+
+        /**
+         * @brief Scrolls display content.
+         * @param pixels Number of lines content moves up, negative values move it down.
+         */
+        void scroll(int pixels) {
+            setStartLine(_startLine + pixels);
+        }
+
+        /**
+         * @brief Resets start line to 0, so full frames could be rendered by regular page loop.
+         */
+        void reset() {
+            if (_startLine != 0) {
+                setStartLine(0);
+            }
+        }
+
+        /**
+         * @brief Gets RAM pages showing screen lines band.
+         * @param top First screen line of band.
+         * @param bottom Last screen line of band.
+         * @return Returns mask of RAM pages, bit n is set for page n.
+         */
+        byte getPageMask(u8g_uint_t top, u8g_uint_t bottom) {
+            byte mask = 0;
+            for (u8g_uint_t line = top; line <= bottom && line < OLED_SCROLL_HEIGHT; line++) {
+                mask |= 1 << (((line + _startLine) & (OLED_SCROLL_HEIGHT - 1)) >> 3);
+            }
+            return mask;
+        }
+
+        /**
+         * @brief Gets vertical offset of scene copy in RAM coordinates.
+         * @param copy Scene copy, 0 to OLED_SCROLL_COPIES - 1.
+         */
+        u8g_uint_t getOffset(byte copy) {
+            return copy == 0 ? _startLine : _startLine - OLED_SCROLL_HEIGHT;
+        }
+
+        /**
+         * @brief Starts page loop of RAM pages in mask.
+         * @param pageMask Mask of RAM pages to be rendered, see getPageMask().
+         * @return Returns false if mask is empty and nothing has to be drawn.
+         */
+        bool firstPage(byte pageMask) {
+            _pageMask = pageMask;
+            _oled->firstPage();
+            return seekPage(0);
+        }
+
+        /**
+         * @brief Sends current page and moves page loop to next page in mask.
+         * @return Returns true if next page has to be drawn or false if page loop has finished.
+         */
+        bool nextPage() {
+            if (!_oled->nextPage()) {
+                return false;
+            }
+            return seekPage(getPageBuffer()->p.page);
+        }
+};
+
+#endif
@@ -0,0 +1,220 @@
+/**
+ * @brief Exact per-function cycle profiler with collapsed stack output.
+ *
+ * Every profiled scope is a node in call tree identified by its parent node and name pointer.
+ * Scope cycles are measured by CycleCounter and attributed to node as self cycles, cycles spent
+ * in nested profiled scopes are attributed to their own nodes. Report is printed in collapsed
+ * stack format (`loop;renderGenerator 123456`) ready for flame graph tools.
+ *
+ * Names are expected to be stored in flash (PSTR), two scopes with the same name literal at
+ * different places are distinct nodes.
+ *
+ * Every node also keeps worst case (maximal) inclusive cycles of single scope pass. Scope could
+ * be given cycles budget, exceeded budgets are listed at the end of report.
+ *
+ * @author https://github.com/Konajka
+ * @version 0.1 2026-10-18
+ *      Base implementation.
+ * @version 0.2 2026-10-18
+ *      Added worst case cycles and scope budgets.
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <Arduino.h>
+#include "CycleCounter.h"
+
+// Maximal number of distinct call tree nodes
+#ifndef PROFILER_MAX_NODES
+#define PROFILER_MAX_NODES 16
+#endif
+
+// Maximal nesting of profiled scopes
+#ifndef PROFILER_MAX_DEPTH
+#define PROFILER_MAX_DEPTH 6
+#endif
+
+// No node index
+#define PROFILER_NONE 0xFF
+
+/* Call tree node */
+struct ProfilerNode {
+    const char* name;
+    byte parent;
+    unsigned long cycles;
+    unsigned long maxCycles;
+    unsigned long budget;
+};
+
+/* Active scope on profiler stack */
+struct ProfilerFrame {
+    byte node;
+    unsigned long start;
+    unsigned long children;
+};
+
+/**
+ * @brief Profiler controller class. All methods are static, profiler is singleton.
+ */
+class Profiler
+{
+    private:
+        static ProfilerNode _nodes[PROFILER_MAX_NODES];
+        static byte _nodeCount;
+        static ProfilerFrame _stack[PROFILER_MAX_DEPTH];
+        static byte _depth;
+        static bool _overflow;
+
+        /**
+         * @brief Finds or creates node with given name under given parent.
+         * @return Returns node index or PROFILER_NONE if node table is full.
+         */
+        static byte getNode(byte parent, const char* name) {
+            for (byte index = 0; index < _nodeCount; index++) {
+                if (_nodes[index].parent == parent && _nodes[index].name == name) {
+                    return index;
+                }
+            }
+            if (_nodeCount >= PROFILER_MAX_NODES) {
+                return PROFILER_NONE;
+            }
+            _nodes[_nodeCount].name = name;
+            _nodes[_nodeCount].parent = parent;
+            _nodes[_nodeCount].cycles = 0;
+            _nodes[_nodeCount].maxCycles = 0;
+            _nodes[_nodeCount].budget = 0;
+            return _nodeCount++;
+        }
+
+        /**
+         * @brief Prints node path from root separated by semicolon.
+         */
+        static void printPath(Print &out, byte node) {
+            if (_nodes[node].parent != PROFILER_NONE) {
+                printPath(out, _nodes[node].parent);
+                out.print(';');
+            }
+            out.print((const __FlashStringHelper*) _nodes[node].name);
+        }
+
+    public:
+
+        /**
+         * @brief Enters profiled scope. Every call has to be paired with `leave()`.
+         * @param name Scope name stored in flash.
+         * @param budget Maximal inclusive cycles of single scope pass or 0 for no budget.
+         */
+        static void enter(const char* name, unsigned long budget = 0) {
+            if (_depth >= PROFILER_MAX_DEPTH) {
+                _overflow = true;
+                _depth++;
+                return;
+            }
+            byte parent = _depth > 0 ? _stack[_depth - 1].node : PROFILER_NONE;
+            byte node = parent == PROFILER_NONE && _depth > 0 ? PROFILER_NONE : getNode(parent, name);
+            if (node == PROFILER_NONE) {
+                _overflow = true;
+            } else if (budget > 0) {
+                _nodes[node].budget = budget;
+            }
+            ProfilerFrame &frame = _stack[_depth++];
+            frame.node = node;
+            frame.children = 0;
+            frame.start = CycleCounter::now();
+        }
+
+        /**
+         * @brief Leaves profiled scope entered last and attributes its self cycles.
+         */
+        static void leave() {
+            unsigned long now = CycleCounter::now();
+            if (_depth == 0) {
+                return;
+            }
+            if (_depth-- > PROFILER_MAX_DEPTH) {
+                return;
+            }
+            ProfilerFrame &frame = _stack[_depth];
+            unsigned long total = now - frame.start;
+            if (frame.node != PROFILER_NONE) {
+                ProfilerNode &node = _nodes[frame.node];
+                node.cycles += total - frame.children;
+                if (total > node.maxCycles) {
+                    node.maxCycles = total;
+                }
+            }
+            if (_depth > 0) {
+                _stack[_depth - 1].children += total;
+            }
+        }
+
+        /**
+         * @brief Prints all nodes in collapsed stack format, one node per line.
+         * @param out Output stream, e.g. Serial.
+         */
+        static void report(Print &out) {
+            for (byte index = 0; index < _nodeCount; index++) {
+                printPath(out, index);
+                out.print(' ');
+                out.println(_nodes[index].cycles);
+            }
+            if (_overflow) {
+                out.println(F("# profiler overflow, increase PROFILER_MAX_NODES or PROFILER_MAX_DEPTH"));
+            }
+            for (byte index = 0; index < _nodeCount; index++) {
+                if (!isWithinBudget(index)) {
+                    out.print(F("# budget exceeded "));
+                    printPath(out, index);
+                    out.print(F(" max "));
+                    out.print(_nodes[index].maxCycles);
+                    out.print(F(" budget "));
+                    out.print(_nodes[index].budget);
+                    out.println(F(" cycles"));
+                }
+            }
+        }
+
+        /**
+         * @brief Gets if worst case cycles of node are within its budget.
+         * @param node Node index.
+         * @return Returns false if node has budget and it was exceeded, true otherwise.
+         */
+        static bool isWithinBudget(byte node) {
+            return _nodes[node].budget == 0 || _nodes[node].maxCycles <= _nodes[node].budget;
+        }
+
+        /**
+         * @brief Clears collected cycles. Worst case cycles are kept. Call this outside of any
+         * profiled scope.
+         */
+        static void reset() {
+            for (byte index = 0; index < _nodeCount; index++) {
+                _nodes[index].cycles = 0;
+            }
+            _overflow = false;
+        }
+};
+
+ProfilerNode Profiler::_nodes[PROFILER_MAX_NODES];
+byte Profiler::_nodeCount = 0;
+ProfilerFrame Profiler::_stack[PROFILER_MAX_DEPTH];
+byte Profiler::_depth = 0;
+bool Profiler::_overflow = false;
+
+/**
+ * @brief Profiled scope guard, enters scope on construction and leaves it on destruction.
+ */
+class ProfilerScope
+{
+    public:
+        ProfilerScope(const char* name, unsigned long budget = 0) {
+            Profiler::enter(name, budget);
+        }
+
+        ~ProfilerScope() {
+            Profiler::leave();
+        }
+};
+
+#endif
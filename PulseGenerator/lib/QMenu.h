@@ -26,6 +26,14 @@
  *  Added checked flag to item instantiation.
  * @version 1.0 2019-07-04
  *  Stable version.
+ * @version 1.1 2026-10-18
+ *  Added policy-based item layout, compact policy with byte ids, flash captions and pooled
+ *  items linked by indexes.
+ *  Separated menu cursor from menu tree, renderers render cursor.
+ *  Added conditional items with cached visibility and enable predicates.
+ *  Added inline edit mode to list renderer.
+ *  Added viewport update without rendering for hardware scrolling.
+ *  Added grid renderer with page aligned icon cells and caption line.
  */
 
 #ifndef QMENU_H
@@ -37,38 +45,266 @@
 #define QMENU_ITEM_REGULAR 0
 #define QMENU_ITEM_CHECKABLE 255
 
+/* Item flags, visibility and enable flags are cached predicate results */
+#define QMENU_FLAG_CHECKED 0x01
+#define QMENU_FLAG_CONDITIONAL 0x02
+#define QMENU_FLAG_CACHED 0x04
+#define QMENU_FLAG_VISIBLE 0x08
+#define QMENU_FLAG_ENABLED 0x10
+
+// Viewport moved to another menu level, see QMenuListRenderer::updateViewport()
+#define QMENU_VIEWPORT_RESET 0x7FFF
+
+// Display page height of grid renderer, cells and caption line are aligned to pages
+#define QMENU_GRID_PAGE_HEIGHT 8
+
+// Number of parent levels whose active indexes are kept by cursor, deeper levels are rescanned
+#ifndef QMENU_CURSOR_DEPTH
+#define QMENU_CURSOR_DEPTH 4
+#endif
+
+// Number of items in static pool of compact policy
+#ifndef QMENU_POOL_SIZE
+#define QMENU_POOL_SIZE 32
+#endif
+
 /**
- * @brief Menu item definition.
+ * @brief Menu item layout policy. Items contain only fields enabled by their policy.
+ * @param Id Item identification type, e.g. int or byte.
+ * @param Caption Caption type, char* for captions in RAM or const __FlashStringHelper* for
+ *      captions in flash created via F() macro.
+ * @param userData Set to true to keep user custom tag and data pointer in items.
+ * @param poolSize Set to 0 to allocate items on heap and link them by pointers or set number
+ *      of items (up to 255) in static pool to link them by byte indexes. Pool has to fit all
+ *      items including root, item factories return NULL when it is exhausted.
  */
-class QMenuItem {
-    private:
-        /* Item identification */
-        int _id;
+template <typename Id, typename Caption, bool userData, byte poolSize>
+struct QMenuPolicy {
+    typedef Id IdType;
+    typedef Caption CaptionType;
+    static const bool hasUserData = userData;
+    static const byte itemPoolSize = poolSize;
+};
 
-        /* Printable caption */
-        char* _caption;
+/* Full layout, int ids, RAM captions, user data, heap items linked by pointers */
+typedef QMenuPolicy<int, char*, true, 0> QMenuDefaultPolicy;
 
+/* Compact layout, byte ids, flash captions, no user data, pooled items linked by indexes */
+typedef QMenuPolicy<byte, const __FlashStringHelper*, false, QMENU_POOL_SIZE> QMenuCompactPolicy;
+
+// Policy of QMenuItem, QMenu and renderer types
+#ifndef QMENU_POLICY
+#define QMENU_POLICY QMenuDefaultPolicy
+#endif
+
+/**
+ * @brief User custom item data, present if enabled by policy.
+ */
+template <bool enabled>
+class QMenuItemUserData {
+    private:
         /* Custom integer data */
-        int _tag = 0;
+        int _tag;
 
         /* Custom pointer data */
-        void* _data = NULL;
+        void* _data;
+
+    public:
+        constexpr QMenuItemUserData() : _tag(0), _data(NULL) {}
+
+        /**
+         * @brief Gets user custom integer value.
+         * @return Returns tag value.
+         */
+        int getTag() const {
+            return _tag;
+        }
+
+        /**
+         * @brief Sets user custom integer value.
+         */
+        void setTag(int tag) {
+            _tag = tag;
+        }
+
+        /**
+         * @brief Gets user defined data pointer.
+         * @return Returns void pointer to custom data.
+         */
+        void* getData() const {
+            return _data;
+        }
+
+        /**
+         * @brief Sets user defined data pointer.
+         */
+        void setData(void* data) {
+            _data = data;
+        }
+};
+
+/* No user custom item data */
+template <>
+class QMenuItemUserData<false> {
+    public:
+        constexpr QMenuItemUserData() {}
+};
+
+/**
+ * @brief Item allocation and linking, pooled items linked by byte indexes. Pool is statically
+ * allocated and has to fit all items of menu, items are never released.
+ */
+template <typename Item, byte poolSize>
+class QMenuItemStorage {
+    private:
+        static Item _pool[poolSize];
+        static byte _used;
+
+    public:
+        typedef byte Link;
+        static const Link NONE = 0xFF;
+
+        /**
+         * @brief Allocates item from pool.
+         * @return Returns unused pool item or NULL if pool is exhausted.
+         */
+        static Item* allocate() {
+            return _used < poolSize ? &_pool[_used++] : NULL;
+        }
+
+        /**
+         * @brief Gets link to item.
+         * @return Returns item's pool index or NONE if item is NULL.
+         */
+        static Link toLink(Item* item) {
+            return item != NULL ? item - _pool : NONE;
+        }
+
+        /**
+         * @brief Gets linked item.
+         * @return Returns item at pool index or NULL if link is NONE.
+         */
+        static Item* toItem(Link link) {
+            return link != NONE ? &_pool[link] : NULL;
+        }
+};
+
+template <typename Item, byte poolSize>
+Item QMenuItemStorage<Item, poolSize>::_pool[poolSize];
+
+template <typename Item, byte poolSize>
+byte QMenuItemStorage<Item, poolSize>::_used = 0;
+
+/**
+ * @brief Item allocation and linking, heap allocated items linked by pointers.
+ */
+template <typename Item>
+class QMenuItemStorage<Item, 0> {
+    public:
+        typedef Item* Link;
+        static constexpr Link NONE = NULL;
+
+        static Item* allocate() {
+            return new Item();
+        }
+
+        static Link toLink(Item* item) {
+            return item;
+        }
+
+        static Item* toItem(Link link) {
+            return link;
+        }
+};
+
+/**
+ * @brief Menu item definition.
+ */
+template <typename Policy>
+class QMenuItemT : public QMenuItemUserData<Policy::hasUserData> {
+    public:
+        typedef typename Policy::IdType Id;
+        typedef typename Policy::CaptionType Caption;
+        typedef QMenuItemStorage<QMenuItemT, Policy::itemPoolSize> Storage;
+
+        /** Item visibility or enable predicate */
+        typedef bool (*Predicate) (const QMenuItemT*);
+
+    private:
+        typedef typename Storage::Link Link;
+
+        /* Predicates of conditional items and revision of cached results, shared by all items */
+        static Predicate _visiblePredicate;
+        static Predicate _enabledPredicate;
+        static byte _revision;
+
+        /* Item identification */
+        Id _id;
+
+        /* Printable caption */
+        Caption _caption;
 
         /* Group index
             0 - regular item, not groupped, not checkable
             1-254 - item is radio item, number is radio group index
             255 - item is checkable
          */
-        byte _groupIndex = QMENU_ITEM_REGULAR;
+        byte _groupIndex;
 
-        /* Radio group item or checkable item checked flag */
-        bool _checked = false;
+        /* Checked flag of radio group or checkable item and conditional item flags with cached
+            predicate results, see QMENU_FLAG_* */
+        mutable byte _flags;
 
         /* Links to neighbour items */
-        QMenuItem* _back = NULL;
-        QMenuItem* _menu = NULL;
-        QMenuItem* _prev = NULL;
-        QMenuItem* _next = NULL;
+        Link _back;
+        Link _menu;
+        Link _prev;
+        Link _next;
+
+        /**
+         * @brief Evaluates predicates of conditional item unless results are cached.
+         * @return Returns item flags with valid results.
+         */
+        byte evaluate() const {
+            if (!(_flags & QMENU_FLAG_CACHED)) {
+                _flags &= ~(QMENU_FLAG_VISIBLE | QMENU_FLAG_ENABLED);
+                if (_visiblePredicate == NULL || _visiblePredicate(this)) {
+                    _flags |= QMENU_FLAG_VISIBLE;
+                }
+                if (_enabledPredicate == NULL || _enabledPredicate(this)) {
+                    _flags |= QMENU_FLAG_ENABLED;
+                }
+                _flags |= QMENU_FLAG_CACHED;
+            }
+            return _flags;
+        }
+
+        /**
+         * @brief Clears cached predicate results in level and its submenus.
+         * @param item First item of level.
+         */
+        static void clearCache(QMenuItemT* item) {
+            while (item != NULL) {
+                item->_flags &= ~QMENU_FLAG_CACHED;
+                clearCache(item->getMenu());
+                item = item->getNext();
+            }
+        }
+
+        /**
+         * @brief Allocates item by policy and initializes it.
+         * @param id Menu item identification.
+         * @param caption Menu item caption.
+         * @return Returns new item or NULL if static pool is exhausted.
+         */
+        static QMenuItemT* allocate(Id id, Caption caption) {
+            QMenuItemT* item = Storage::allocate();
+            if (item != NULL) {
+                item->_id = id;
+                item->_caption = caption;
+            }
+            return item;
+        }
 
     public:
 
@@ -77,49 +313,62 @@ class QMenuItem {
          * @param id Menu item identification. This could be unique integer value, but no unique
          *      test is performed.
          * @param caption Menu item caption.
+         * @return Returns new item or NULL if static pool is exhausted.
          */
-        static QMenuItem* create(int id, char* caption) {
-            return new QMenuItem(id, caption);
+        static QMenuItemT* create(Id id, Caption caption) {
+            return allocate(id, caption);
         }
 
         /**
-         * @brief Static QMenuItem instantiating and initialization.
+         * @brief Static QMenuItem instantiating and initialization. Requires policy with user
+         *      data.
          * @param id Menu item identification. This could be unique integer value, but no unique
          *      test is performed.
          * @param caption Menu item caption.
          * @param tag User defined integer value.
+         * @return Returns new item or NULL if static pool is exhausted.
          */
-        static QMenuItem* create(int id, char* caption, int tag) {
-            QMenuItem* item = new QMenuItem(id, caption);
-            item->setTag(tag);
+        static QMenuItemT* create(Id id, Caption caption, int tag) {
+            QMenuItemT* item = allocate(id, caption);
+            if (item != NULL) {
+                item->setTag(tag);
+            }
             return item;
         }
 
         /**
-         * @brief Static QMenuItem instantiating and initialization.
+         * @brief Static QMenuItem instantiating and initialization. Requires policy with user
+         *      data.
          * @param id Menu item identification. This could be unique integer value, but no unique
          *      test is performed.
          * @param caption Menu item caption.
          * @param data User defined data pointer.
+         * @return Returns new item or NULL if static pool is exhausted.
          */
-        static QMenuItem* create(int id, char* caption, void* data) {
-            QMenuItem* item = new QMenuItem(id, caption);
-            item->setData(data);
+        static QMenuItemT* create(Id id, Caption caption, void* data) {
+            QMenuItemT* item = allocate(id, caption);
+            if (item != NULL) {
+                item->setData(data);
+            }
             return item;
         }
 
         /**
-         * @brief Static QMenuItem instantiating and initialization.
+         * @brief Static QMenuItem instantiating and initialization. Requires policy with user
+         *      data.
          * @param id Menu item identification. This could be unique integer value, but no unique
          *      test is performed.
          * @param caption Menu item caption.
          * @param tag User defined integer value.
          * @param data User defined data pointer.
+         * @return Returns new item or NULL if static pool is exhausted.
          */
-        static QMenuItem* create(int id, char* caption, int tag, void* data) {
-            QMenuItem* item = new QMenuItem(id, caption);
-            item->setTag(tag);
-            item->setData(data);
+        static QMenuItemT* create(Id id, Caption caption, int tag, void* data) {
+            QMenuItemT* item = allocate(id, caption);
+            if (item != NULL) {
+                item->setTag(tag);
+                item->setData(data);
+            }
             return item;
         }
 
@@ -130,16 +379,20 @@ class QMenuItem {
          * @param caption Menu item caption.
          * @param groupIndex Item's group index to be set.
          * @param checked Set to true to initialize item as checked or false to not checked.
+         * @return Returns new item or NULL if static pool is exhausted.
          */
-        static QMenuItem* createRadio(int id, char* caption, byte groupIndex, bool checked) {
-            QMenuItem* item = new QMenuItem(id, caption);
-            item->setGroupIndex(groupIndex);
-            item->setChecked(checked);
+        static QMenuItemT* createRadio(Id id, Caption caption, byte groupIndex, bool checked) {
+            QMenuItemT* item = allocate(id, caption);
+            if (item != NULL) {
+                item->setGroupIndex(groupIndex);
+                item->setChecked(checked);
+            }
             return item;
         }
 
         /**
-         * @brief Static QMenuItem instantiating and initialization.
+         * @brief Static QMenuItem instantiating and initialization. Requires policy with user
+         *      data.
          * @param id Menu item identification. This could be unique integer value, but no unique
          *      test is performed.
          * @param caption Menu item caption.
@@ -147,102 +400,147 @@ class QMenuItem {
          * @param checked Set to true to initialize item as checked or false to not checked.
          * @param tag User defined integer value.
          * @param data User defined data pointer.
+         * @return Returns new item or NULL if static pool is exhausted.
          */
-        static QMenuItem* createRadio(int id, char* caption, byte groupIndex, bool checked, int tag, void* data) {
-            QMenuItem* item = new QMenuItem(id, caption);
-            item->setGroupIndex(groupIndex);
-            item->setChecked(checked);
-            item->setTag(tag);
-            item->setData(data);
+        static QMenuItemT* createRadio(Id id, Caption caption, byte groupIndex, bool checked, int tag, void* data) {
+            QMenuItemT* item = allocate(id, caption);
+            if (item != NULL) {
+                item->setGroupIndex(groupIndex);
+                item->setChecked(checked);
+                item->setTag(tag);
+                item->setData(data);
+            }
             return item;
         }
 
-                /**
+        /**
          * @brief Static QMenuItem instantiating and initialization.
          * @param id Menu item identification. This could be unique integer value, but no unique
          *      test is performed.
          * @param caption Menu item caption.
          * @param checked Set to true to initialize item as checked or false to not checked.
+         * @return Returns new item or NULL if static pool is exhausted.
          */
-        static QMenuItem* createCheckable(int id, char* caption, bool checked) {
-            QMenuItem* item = new QMenuItem(id, caption);
-            item->setGroupIndex(QMENU_ITEM_CHECKABLE);
-            item->setChecked(checked);
+        static QMenuItemT* createCheckable(Id id, Caption caption, bool checked) {
+            QMenuItemT* item = allocate(id, caption);
+            if (item != NULL) {
+                item->setGroupIndex(QMENU_ITEM_CHECKABLE);
+                item->setChecked(checked);
+            }
             return item;
         }
 
         /**
-         * @brief Static QMenuItem instantiating and initialization.
+         * @brief Static QMenuItem instantiating and initialization. Requires policy with user
+         *      data.
          * @param id Menu item identification. This could be unique integer value, but no unique
          *      test is performed.
          * @param caption Menu item caption.
          * @param checked Set to true to initialize item as checked or false to not checked.
          * @param tag User defined integer value.
          * @param data User defined data pointer.
+         * @return Returns new item or NULL if static pool is exhausted.
          */
-        static QMenuItem* createCheckable(int id, char* caption, bool checked, int tag, void* data) {
-            QMenuItem* item = new QMenuItem(id, caption);
-            item->setGroupIndex(QMENU_ITEM_CHECKABLE);
-            item->setChecked(checked);
-            item->setTag(tag);
-            item->setData(data);
+        static QMenuItemT* createCheckable(Id id, Caption caption, bool checked, int tag, void* data) {
+            QMenuItemT* item = allocate(id, caption);
+            if (item != NULL) {
+                item->setGroupIndex(QMENU_ITEM_CHECKABLE);
+                item->setChecked(checked);
+                item->setTag(tag);
+                item->setData(data);
+            }
             return item;
         }
 
         /**
-         * @brief Creates new QMenuItem instance.
-         * @param id Menu item identification.
+         * @brief Static QMenuItem instantiating and initialization. Item visibility and enable
+         *      state are evaluated by predicates, see setVisiblePredicate() and
+         *      setEnabledPredicate().
+         * @param id Menu item identification. This could be unique integer value, but no unique
+         *      test is performed.
          * @param caption Menu item caption.
+         * @return Returns new item or NULL if static pool is exhausted.
          */
-        QMenuItem(int id, char* caption) {
-            _id = id;
-            _caption = caption;
+        static QMenuItemT* createConditional(Id id, Caption caption) {
+            QMenuItemT* item = allocate(id, caption);
+            if (item != NULL) {
+                item->setConditional(true);
+            }
+            return item;
         }
 
         /**
-         * @brief Gets menu item identification.
-         * @return Returns menu item identification.
+         * @brief Sets predicate evaluating visibility of conditional items. Hidden items are
+         *      skipped by cursors and renderers. Predicate is shared by all items of policy,
+         *      i.e. by all menus using the same item type.
+         * @param predicate Predicate function or NULL to show all items.
          */
-        int getId() {
-            return this->_id;
+        static void setVisiblePredicate(Predicate predicate) {
+            _visiblePredicate = predicate;
         }
 
         /**
-         * @brief Gets menu item caption.
-         * @return Returns menu item caption.
+         * @brief Sets predicate evaluating enable state of conditional items. Disabled items are
+         *      rendered but can not be entered or utilized. Predicate is shared by all items of
+         *      policy, i.e. by all menus using the same item type.
+         * @param predicate Predicate function or NULL to enable all items.
          */
-        char* getCaption() {
-            return this->_caption;
+        static void setEnabledPredicate(Predicate predicate) {
+            _enabledPredicate = predicate;
         }
 
         /**
-         * @brief Gets user custom integer value.
-         * @return Returns tag value.
+         * @brief Gets revision of cached predicate results. Revision changes whenever cached
+         *      results are invalidated, so holders of positions computed from visibility could
+         *      detect they are stale.
          */
-        int getTag() {
-            return _tag;
+        static byte getRevision() {
+            return _revision;
         }
 
         /**
-         * @brief Sets user custom integer value.
+         * @brief Invalidates cached predicate results of conditional items in level and its
+         *      submenus and changes revision. Call it when state predicates depend on changes.
+         * @param item First item of level to be invalidated, e.g. menu root item.
          */
-        void setTag(int tag) {
-            _tag = tag;
+        static void invalidate(QMenuItemT* item) {
+            clearCache(item);
+            _revision++;
         }
 
         /**
-         * @brief Gets user defined data pointer.
-         * @return Returns void pointer to custom data.
+         * @brief Creates empty QMenuItem instance. Constant initialized, so pooled items are
+         *      ready before any static constructor runs.
          */
-        void* getData() {
-            return _data;
+        constexpr QMenuItemT()
+            : _id(0), _caption(NULL), _groupIndex(QMENU_ITEM_REGULAR), _flags(0),
+              _back(Storage::NONE), _menu(Storage::NONE), _prev(Storage::NONE),
+              _next(Storage::NONE) {}
+
+        /**
+         * @brief Creates new QMenuItem instance.
+         * @param id Menu item identification.
+         * @param caption Menu item caption.
+         */
+        constexpr QMenuItemT(Id id, Caption caption)
+            : _id(id), _caption(caption), _groupIndex(QMENU_ITEM_REGULAR), _flags(0),
+              _back(Storage::NONE), _menu(Storage::NONE), _prev(Storage::NONE),
+              _next(Storage::NONE) {}
+
+        /**
+         * @brief Gets menu item identification.
+         * @return Returns menu item identification.
+         */
+        Id getId() const {
+            return this->_id;
         }
 
         /**
-         * @brief Sets user defined data pointer.
+         * @brief Gets menu item caption.
+         * @return Returns menu item caption.
          */
-        void setData(void* data) {
-            _data = data;
+        Caption getCaption() const {
+            return this->_caption;
         }
 
         /**
@@ -250,8 +548,8 @@ class QMenuItem {
          * group index (or item type).
          * @return Returns true if this item is checked or false if not.
          */
-        bool isChecked() {
-            return _checked;
+        bool isChecked() const {
+            return _flags & QMENU_FLAG_CHECKED;
         }
 
         /**
@@ -260,8 +558,45 @@ class QMenuItem {
          * setGroupIndex().
          * @param checked Set true to flag this item checked or false to unchecked.
          */
-        bool setChecked(bool checked) {
-            _checked = checked;
+        void setChecked(bool checked) {
+            if (checked) {
+                _flags |= QMENU_FLAG_CHECKED;
+            } else {
+                _flags &= ~QMENU_FLAG_CHECKED;
+            }
+        }
+
+        /**
+         * @brief Gets if item visibility and enable state are evaluated by predicates.
+         */
+        bool isConditional() const {
+            return _flags & QMENU_FLAG_CONDITIONAL;
+        }
+
+        /**
+         * @brief Sets if item visibility and enable state are evaluated by predicates.
+         */
+        void setConditional(bool conditional) {
+            _flags = (conditional ? _flags | QMENU_FLAG_CONDITIONAL : _flags & ~QMENU_FLAG_CONDITIONAL)
+                    & ~QMENU_FLAG_CACHED;
+        }
+
+        /**
+         * @brief Gets if item is visible. Predicate of conditional item is evaluated only if its
+         *      cached result has been invalidated.
+         * @return Returns true if item is visible or false if it is hidden.
+         */
+        bool isVisible() const {
+            return !isConditional() || (evaluate() & QMENU_FLAG_VISIBLE);
+        }
+
+        /**
+         * @brief Gets if item is enabled. Predicate of conditional item is evaluated only if its
+         *      cached result has been invalidated.
+         * @return Returns true if item is enabled or false if it is disabled.
+         */
+        bool isEnabled() const {
+            return !isConditional() || (evaluate() & QMENU_FLAG_ENABLED);
         }
 
         /**
@@ -275,7 +610,7 @@ class QMenuItem {
          *          items with same value. Current state is controlled via isChecked() and
          *          setChecked() methods.
          */
-        byte getGroupIndex() {
+        byte getGroupIndex() const {
             return _groupIndex;
         }
 
@@ -298,7 +633,7 @@ class QMenuItem {
          * @brief Gets if the item is regular menu item (not radio or checkable item).
          * @return Returns true if this item is regular item or false if not.
          */
-        bool isRegular() {
+        bool isRegular() const {
             return _groupIndex == QMENU_ITEM_REGULAR;
         }
 
@@ -315,7 +650,7 @@ class QMenuItem {
          * @brief Gets if the item is radio group item (has set valid radio group index).
          * @return Returns true if this item is radio group item or false if not.
          */
-        bool isRadio() {
+        bool isRadio() const {
             return (_groupIndex > QMENU_ITEM_REGULAR) && (_groupIndex < QMENU_ITEM_CHECKABLE);
         }
 
@@ -323,7 +658,7 @@ class QMenuItem {
          * @brief Gets if the item is checkable menu item.
          * @return Returns true if this item is checkable item or false if not.
          */
-        bool isCheckable() {
+        bool isCheckable() const {
             return _groupIndex == QMENU_ITEM_CHECKABLE;
         }
 
@@ -340,16 +675,16 @@ class QMenuItem {
          * @brief Gets parent menu item.
          * @return Returns parent menu item reference or NULL if this item is top menu item.
          */
-        QMenuItem* getBack() {
-            return this->_back;
+        QMenuItemT* getBack() const {
+            return Storage::toItem(this->_back);
         }
 
         /**
          * @brief Gets if this item has submenu.
          * @return Returns if this item has submenu or false if not.
          */
-        bool hasSubmenu() {
-            return this->_menu != NULL;
+        bool hasSubmenu() const {
+            return this->_menu != Storage::NONE;
         }
 
         /**
@@ -357,18 +692,17 @@ class QMenuItem {
          * @return Returns first menu item reference from submenu or NULL if this item has no
          *      submenu.
          */
-        QMenuItem* getMenu() {
-            return this->_menu;
+        QMenuItemT* getMenu() const {
+            return Storage::toItem(this->_menu);
         }
 
         /**
          * @brief Sets first submenu item.
-         * @param menu Reference to menu item that has to be first submenu item. Value of NULL
-         * clears submenu.
+         * @param menu Reference to menu item that has to be first submenu item.
          */
-        QMenuItem* setMenu(QMenuItem* menu) {
-            this->_menu = menu;
-            menu->_back = this;
+        QMenuItemT* setMenu(QMenuItemT* menu) {
+            this->_menu = Storage::toLink(menu);
+            menu->_back = Storage::toLink(this);
             return menu;
         }
 
@@ -376,16 +710,72 @@ class QMenuItem {
          * @brief Get previous menu item in current menu level.
          * @return Returns previous item in current menu level or NULL if this item is first.
          */
-        QMenuItem* getPrev() {
-            return this->_prev;
+        QMenuItemT* getPrev() const {
+            return Storage::toItem(this->_prev);
+        }
+
+        /**
+         * @brief Gets first menu item in current menu level.
+         * @return Returns first item in current menu level, this item if it is first.
+         */
+        QMenuItemT* getTop() const {
+            QMenuItemT* top = (QMenuItemT*) this;
+            while (top->getPrev() != NULL) {
+                top = top->getPrev();
+            }
+            return top;
+        }
+
+        /**
+         * @brief Gets previous visible menu item in current menu level.
+         * @return Returns previous visible item or NULL if there is no one.
+         */
+        QMenuItemT* getPrevVisible() const {
+            QMenuItemT* item = getPrev();
+            while (item != NULL && !item->isVisible()) {
+                item = item->getPrev();
+            }
+            return item;
+        }
+
+        /**
+         * @brief Gets next visible menu item in current menu level.
+         * @return Returns next visible item or NULL if there is no one.
+         */
+        QMenuItemT* getNextVisible() const {
+            QMenuItemT* item = getNext();
+            while (item != NULL && !item->isVisible()) {
+                item = item->getNext();
+            }
+            return item;
+        }
+
+        /**
+         * @brief Gets first visible item of level starting by this item.
+         * @return Returns this item if visible, next visible item or NULL if there is no one.
+         */
+        QMenuItemT* getFirstVisible() const {
+            return isVisible() ? (QMenuItemT*) this : getNextVisible();
+        }
+
+        /**
+         * @brief Gets visible index of this item in current menu level.
+         * @return Returns number of visible items before this item.
+         */
+        int getVisibleIndex() const {
+            int index = 0;
+            for (QMenuItemT* item = getPrevVisible(); item != NULL; item = item->getPrevVisible()) {
+                index++;
+            }
+            return index;
         }
 
         /**
          * @brief Get next menu item in current menu level.
          * @return Returns next item in current menu level or NULL if this item is last.
          */
-        QMenuItem* getNext() {
-            return this->_next;
+        QMenuItemT* getNext() const {
+            return Storage::toItem(this->_next);
         }
 
         /**
@@ -393,44 +783,69 @@ class QMenuItem {
          * @param menu Reference to menu item that has to be next item after this item in current
          * menu level.
          */
-        QMenuItem* setNext(QMenuItem* next) {
-            this->_next = next;
-            next->_prev = this;
+        QMenuItemT* setNext(QMenuItemT* next) {
+            this->_next = Storage::toLink(next);
+            next->_prev = Storage::toLink(this);
             next->_back = this->_back;
             return next;
         }
 };
 
+template <typename Policy>
+typename QMenuItemT<Policy>::Predicate QMenuItemT<Policy>::_visiblePredicate = NULL;
+
+template <typename Policy>
+typename QMenuItemT<Policy>::Predicate QMenuItemT<Policy>::_enabledPredicate = NULL;
+
+template <typename Policy>
+byte QMenuItemT<Policy>::_revision = 0;
+
+/* Menu item of selected policy */
+typedef QMenuItemT<QMENU_POLICY> QMenuItem;
+
 /** QMenu on onActiveItemChanged event data */
-struct QMenuActiveItemChangedEvent {
-    const QMenuItem* oldActiveItem;
-    const QMenuItem* newActiveItem;
+template <typename Item>
+struct QMenuActiveItemChangedEventT {
+    const Item* oldActiveItem;
+    const Item* newActiveItem;
 };
 
-/** QMenu on onActiveItemChanged event callback */
-typedef void (*QMenuActiveItemChangedCallback) (QMenuActiveItemChangedEvent);
-
 /** QMenu on onItemUtilized event data */
-struct QMenuItemUtilizedEvent {
-    const QMenuItem* utilizedItem;
+template <typename Item>
+struct QMenuItemUtilizedEventT {
+    const Item* utilizedItem;
 };
 
-/** QMenu on onItemUtilized event callback */
-typedef void (*QMenuItemUtilizedCallback) (QMenuItemUtilizedEvent);
-
 /**
- * @brief Menu backend controller.
+ * @brief Menu navigator. Cursor keeps active item, events and navigation over menu tree, so
+ * several navigators could browse the same tree independently.
  */
-class QMenu {
+template <typename Policy>
+class QMenuCursorT {
+    public:
+        typedef QMenuItemT<Policy> Item;
+
+        /** QMenu on onActiveItemChanged event callback */
+        typedef void (*ActiveItemChangedCallback) (QMenuActiveItemChangedEventT<Item>);
+
+        /** QMenu on onItemUtilized event callback */
+        typedef void (*ItemUtilizedCallback) (QMenuItemUtilizedEventT<Item>);
+
     private:
-        // Root item
-        QMenuItem* _root;
-        // Curretly active item
-        QMenuItem* _active;
+        // Curretly active item and its visible index in menu level
+        Item* _active;
+        int _activeIndex = 0;
+
+        // Visible indexes of active items in parent levels, innermost last
+        int _parentIndexes[QMENU_CURSOR_DEPTH];
+        byte _parentCount = 0;
+
+        // Item revision the active indexes have been computed for
+        byte _revision;
 
         // Events
-        QMenuActiveItemChangedCallback _onActiveItemChanged = NULL;
-        QMenuItemUtilizedCallback _onItemUtilized = NULL;
+        ActiveItemChangedCallback _onActiveItemChanged = NULL;
+        ItemUtilizedCallback _onItemUtilized = NULL;
 
     protected:
 
@@ -439,9 +854,9 @@ class QMenu {
          * @param oldItem Previusly active menu item.
          * @oaram newItem Currently active menu item.
          */
-        void doOnActiveItemChanged(QMenuItem* oldItem, QMenuItem* newItem) {
+        void doOnActiveItemChanged(Item* oldItem, Item* newItem) {
             if (_onActiveItemChanged != NULL) {
-                QMenuActiveItemChangedEvent event = {
+                QMenuActiveItemChangedEventT<Item> event = {
                     oldItem,
                     newItem
                 };
@@ -453,57 +868,99 @@ class QMenu {
          * @brief Calls onItemUtilized event if assigned.
          * @param item Utilized item.
          */
-        void doOnItemUtilized(QMenuItem* item) {
+        void doOnItemUtilized(Item* item) {
             if (_onItemUtilized != NULL) {
-                QMenuItemUtilizedEvent event = {
+                QMenuItemUtilizedEventT<Item> event = {
                     item
                 };
                 _onItemUtilized(event);
             }
         }
 
-    public:
-        /**
-         * @brief Creates new instance and initializes it with default root menu item. Root item is
-         *      set as active menu item.
-         */
-        QMenu() {
-            _root = new QMenuItem(0, "__ROOT__");
-            _active = _root;
-        }
-
         /**
-         * @brief Creates new instance and initializes it with root menu item.
-         * @param id Root menu item identification. This could be unique integer value, but no
-         *      unique test is performed. Root item is set as active menu item.
-         * @param caption Root menu item caption.
+         * @brief Recomputes active index and parent indexes if predicate results have been
+         *      invalidated since they were computed. Active item is not moved.
          */
-        QMenu(int id, char* caption) {
-            _root = new QMenuItem(id, caption);
-            _active = _root;
+        void syncIndex() {
+            if (_revision == Item::getRevision()) {
+                return;
+            }
+            _revision = Item::getRevision();
+            _parentCount = 0;
+            _activeIndex = _active != NULL ? _active->getVisibleIndex() : 0;
         }
 
+    public:
         /**
-         * @brief Gets root menu item.
-         * @return Returns menu root item reference. This is never NULL.
+         * @brief Creates new cursor.
+         * @param active Initially active item, usually menu root item.
          */
-        QMenuItem* getRoot() {
-            return _root;
+        QMenuCursorT(Item* active = NULL) {
+            setActive(active);
         }
 
         /**
          * @brief Gets currently active menu item.
          * @return Returns active menu item reference.
          */
-        QMenuItem* getActive() {
+        Item* getActive() {
             return _active;
         }
 
         /**
-         * @brief Gets onActiveItemChanged callback.
-         * @return Returns onActiveItemChanged callback or NULL if not assigned.
+         * @brief Gets visible index of active item in its menu level. Index is maintained while
+         *      moving, so menu level is not rescanned.
+         * @return Returns zero based index of active item among visible items.
          */
-        QMenuActiveItemChangedCallback getOnActiveItemChanged(){
+        int getActiveIndex() {
+            syncIndex();
+            return _activeIndex;
+        }
+
+        /**
+         * @brief Revalidates cursor after predicate results have been invalidated. Moves from
+         *      active item if it has been hidden and raises onActiveItemChanged event then.
+         *      Moving methods refresh cursor themselves, call it when hidden active item has to
+         *      be left before next move, e.g. before rendering.
+         */
+        void refresh() {
+            syncIndex();
+            if (_active == NULL || _active->isVisible()) {
+                return;
+            }
+
+            Item* oldActive = _active;
+            Item* newActive = _active->getNextVisible();
+            if (newActive == NULL) {
+                newActive = _active->getPrevVisible();
+            }
+            if (newActive == NULL) {
+                newActive = _active->getBack();
+            }
+            _active = newActive;
+            _activeIndex = newActive != NULL ? newActive->getVisibleIndex() : 0;
+            _parentCount = 0;
+            if (newActive != NULL) {
+                doOnActiveItemChanged(oldActive, newActive);
+            }
+        }
+
+        /**
+         * @brief Sets active menu item without raising onActiveItemChanged event.
+         * @param active Item to be active, e.g. item active in another cursor to mirror it.
+         */
+        void setActive(Item* active) {
+            _active = active;
+            _activeIndex = active != NULL ? active->getVisibleIndex() : 0;
+            _parentCount = 0;
+            _revision = Item::getRevision();
+        }
+
+        /**
+         * @brief Gets onActiveItemChanged callback.
+         * @return Returns onActiveItemChanged callback or NULL if not assigned.
+         */
+        ActiveItemChangedCallback getOnActiveItemChanged(){
             return _onActiveItemChanged;
         }
 
@@ -511,7 +968,7 @@ class QMenu {
          * @brief Sets onActiveItemChanged callback.
          * @param onActiveItemChanged The onActiveItemChanged callback.
          */
-        void setOnActiveItemChanged(QMenuActiveItemChangedCallback onActiveItemChanged) {
+        void setOnActiveItemChanged(ActiveItemChangedCallback onActiveItemChanged) {
             _onActiveItemChanged = onActiveItemChanged;
         }
 
@@ -519,7 +976,7 @@ class QMenu {
          * @brief Gets onItemUtilized callback.
          * @return Returns onItemUtilized callback or NULL if not assigned.
          */
-        QMenuItemUtilizedCallback getOnItemUtilized() {
+        ItemUtilizedCallback getOnItemUtilized() {
             return _onItemUtilized;
         }
 
@@ -527,21 +984,23 @@ class QMenu {
          * @brief Sets onItemUtilized callback.
          * @param onItemUtilized The onItemUtilized callback.
          */
-        void setOnItemUtilized(QMenuItemUtilizedCallback onItemUtilized) {
+        void setOnItemUtilized(ItemUtilizedCallback onItemUtilized) {
             _onItemUtilized = onItemUtilized;
         }
 
         /**
-         * @brief Moves to next menu item. Sets currently active item's next item as active menu
-         *      item.
+         * @brief Moves to next menu item. Sets currently active item's next visible item as
+         *      active menu item.
          * @return Returns next menu item reference or NULL if there is no next item.
          */
-        QMenuItem* next() {
+        Item* next() {
+            refresh();
             if (this->_active != NULL) {
-                QMenuItem* oldActive = this->_active;
-                QMenuItem* newActive = this->_active->getNext();
+                Item* oldActive = this->_active;
+                Item* newActive = this->_active->getNextVisible();
                 if (newActive != NULL) {
                     this->_active = newActive;
+                    this->_activeIndex++;
                     doOnActiveItemChanged(oldActive, newActive);
                 }
                 return newActive;
@@ -551,16 +1010,18 @@ class QMenu {
         }
 
         /**
-         * @brief Moves to previous menu item. Sets currently active item's previous item as active
-         *      menu item.
+         * @brief Moves to previous menu item. Sets currently active item's previous visible item
+         *      as active menu item.
          * @return Returns previous menu item reference or NULL if there is no previous item.
          */
-        QMenuItem* prev() {
+        Item* prev() {
+            refresh();
             if (this->_active != NULL) {
-                QMenuItem* oldActive = this->_active;
-                QMenuItem* newActive = this->_active->getPrev();      
+                Item* oldActive = this->_active;
+                Item* newActive = this->_active->getPrevVisible();
                 if (newActive != NULL) {
                     this->_active = newActive;
+                    this->_activeIndex--;
                     doOnActiveItemChanged(oldActive, newActive);
                 }
                 return newActive;
@@ -570,18 +1031,32 @@ class QMenu {
         }
 
         /**
-         * @brief Moves to submenu. Sets currently active item's first child item as active menu
-         *      item.
+         * @brief Moves to submenu. Sets currently active item's first visible child item as active
+         *      menu item. Disabled item is neither entered nor utilized.
          * @return Returns first submenu item reference or NULL if there is no submenu.
          */
-        QMenuItem* enter() {
+        Item* enter() {
+            refresh();
             if (this->_active != NULL) {
-                QMenuItem* oldActive = this->_active;
-                QMenuItem* newActive = this->_active->getMenu();
+                if (!this->_active->isEnabled()) {
+                    return NULL;
+                }
+
+                Item* oldActive = this->_active;
+                Item* submenu = this->_active->getMenu();
+                Item* newActive = submenu != NULL ? submenu->getFirstVisible() : NULL;
                 if (newActive != NULL) {
+                    // Keep parent index for back(), the outermost one is dropped when full
+                    if (this->_parentCount == QMENU_CURSOR_DEPTH) {
+                        memmove(this->_parentIndexes, this->_parentIndexes + 1,
+                                (QMENU_CURSOR_DEPTH - 1) * sizeof(int));
+                        this->_parentCount--;
+                    }
+                    this->_parentIndexes[this->_parentCount++] = this->_activeIndex;
                     this->_active = newActive;
+                    this->_activeIndex = 0;
                     doOnActiveItemChanged(oldActive, newActive);
-                } else {
+                } else if (submenu == NULL) {
                     doOnItemUtilized(this->_active);
                 }
                 return newActive;
@@ -595,12 +1070,16 @@ class QMenu {
          *      item.
          * @return Returns parent menu item reference or NULL if there is no parent item.
          */
-        QMenuItem* back() {
+        Item* back() {
+            refresh();
             if (this->_active != NULL) {
-                QMenuItem* oldActive = this->_active;
-                QMenuItem* newActive = this->_active->getBack();
+                Item* oldActive = this->_active;
+                Item* newActive = this->_active->getBack();
                 if (newActive != NULL) {
                     this->_active = newActive;
+                    this->_activeIndex = this->_parentCount > 0
+                            ? this->_parentIndexes[--this->_parentCount]
+                            : newActive->getVisibleIndex();
                     doOnActiveItemChanged(oldActive, newActive);
                 }
                 return newActive;
@@ -608,6 +1087,145 @@ class QMenu {
 
             return NULL;
         }
+};
+
+/**
+ * @brief Menu backend controller. Menu owns item tree and default cursor, navigation methods of
+ * menu use default cursor, other cursors could be created over the same tree via QMenuCursor.
+ */
+template <typename Policy>
+class QMenuT {
+    public:
+        typedef QMenuItemT<Policy> Item;
+        typedef QMenuCursorT<Policy> Cursor;
+        typedef typename Cursor::ActiveItemChangedCallback ActiveItemChangedCallback;
+        typedef typename Cursor::ItemUtilizedCallback ItemUtilizedCallback;
+
+    private:
+        // Root item
+        Item* _root;
+        // Default cursor
+        Cursor _cursor;
+
+    public:
+        /**
+         * @brief Creates new instance and initializes it with default root menu item. Root item is
+         *      set as active menu item. Requires policy with RAM captions.
+         */
+        QMenuT() {
+            _root = Item::create(0, "__ROOT__");
+            _cursor.setActive(_root);
+        }
+
+        /**
+         * @brief Creates new instance and initializes it with root menu item.
+         * @param id Root menu item identification. This could be unique integer value, but no
+         *      unique test is performed. Root item is set as active menu item.
+         * @param caption Root menu item caption.
+         */
+        QMenuT(typename Item::Id id, typename Item::Caption caption) {
+            _root = Item::create(id, caption);
+            _cursor.setActive(_root);
+        }
+
+        /**
+         * @brief Gets root menu item.
+         * @return Returns menu root item reference. This is never NULL.
+         */
+        Item* getRoot() {
+            return _root;
+        }
+
+        /**
+         * @brief Gets default cursor.
+         * @return Returns default cursor reference. This is never NULL.
+         */
+        Cursor* getCursor() {
+            return &_cursor;
+        }
+
+        /**
+         * @brief Gets active menu item of default cursor.
+         * @return Returns active menu item reference.
+         */
+        Item* getActive() {
+            return _cursor.getActive();
+        }
+
+        /**
+         * @brief Gets onActiveItemChanged callback of default cursor.
+         * @return Returns onActiveItemChanged callback or NULL if not assigned.
+         */
+        ActiveItemChangedCallback getOnActiveItemChanged(){
+            return _cursor.getOnActiveItemChanged();
+        }
+
+        /**
+         * @brief Sets onActiveItemChanged callback of default cursor.
+         * @param onActiveItemChanged The onActiveItemChanged callback.
+         */
+        void setOnActiveItemChanged(ActiveItemChangedCallback onActiveItemChanged) {
+            _cursor.setOnActiveItemChanged(onActiveItemChanged);
+        }
+
+        /**
+         * @brief Gets onItemUtilized callback of default cursor.
+         * @return Returns onItemUtilized callback or NULL if not assigned.
+         */
+        ItemUtilizedCallback getOnItemUtilized() {
+            return _cursor.getOnItemUtilized();
+        }
+
+        /**
+         * @brief Sets onItemUtilized callback of default cursor.
+         * @param onItemUtilized The onItemUtilized callback.
+         */
+        void setOnItemUtilized(ItemUtilizedCallback onItemUtilized) {
+            _cursor.setOnItemUtilized(onItemUtilized);
+        }
+
+        /**
+         * @brief Moves default cursor to next menu item, see QMenuCursor::next().
+         */
+        Item* next() {
+            return _cursor.next();
+        }
+
+        /**
+         * @brief Moves default cursor to previous menu item, see QMenuCursor::prev().
+         */
+        Item* prev() {
+            return _cursor.prev();
+        }
+
+        /**
+         * @brief Moves default cursor to submenu, see QMenuCursor::enter().
+         */
+        Item* enter() {
+            return _cursor.enter();
+        }
+
+        /**
+         * @brief Moves default cursor to parent menu, see QMenuCursor::back().
+         */
+        Item* back() {
+            return _cursor.back();
+        }
+
+        /**
+         * @brief Invalidates cached predicate results of all menu items. Cursors and renderers
+         *      revalidate their positions on next use, see refresh().
+         */
+        void invalidate() {
+            Item::invalidate(_root);
+        }
+
+        /**
+         * @brief Revalidates default cursor, see QMenuCursor::refresh().
+         */
+        void refresh() {
+            _cursor.refresh();
+        }
 
         /**
          * @brief Gets top most item from current.
@@ -615,16 +1233,8 @@ class QMenu {
          * @return Returns top most item in menu or submenu or NULL if given
          *      item is NULL.
          */
-        QMenuItem* getTopItem(QMenuItem* item) {
-            if (item == NULL) {
-                return NULL;
-            }
-
-            QMenuItem* top = item;
-            while (top->getPrev() != NULL) {
-                top = top->getPrev();
-            }
-            return top;
+        Item* getTopItem(Item* item) {
+            return item != NULL ? item->getTop() : NULL;
         }
 
         /**
@@ -634,7 +1244,7 @@ class QMenu {
          * level.
          * @return Returns pointer to first item found with given id or NULL if no item found.
          */
-        QMenuItem* find(int id, bool inTree) {
+        Item* find(typename Item::Id id, bool inTree) {
             return find(getRoot(), id, inTree);
         }
 
@@ -646,15 +1256,15 @@ class QMenu {
          * level.
          * @return Returns pointer to first item found with given id or NULL if no item found.
          */
-        QMenuItem* find(const QMenuItem* root, int id, bool inTree) {
-            QMenuItem* item = root;
+        Item* find(Item* root, typename Item::Id id, bool inTree) {
+            Item* item = root;
             while (item != NULL) {
                 // Check this item is target
                 if (item->getId() == id) {
                     return item;
                 // Try find it in submenu
                 } else if (inTree && item->getMenu() != NULL) {
-                    QMenuItem* result = find(item->getMenu(), id, inTree);
+                    Item* result = find(item->getMenu(), id, inTree);
                     if (result != NULL) {
                         return result;
                     }
@@ -671,7 +1281,7 @@ class QMenu {
          * @return Returns pointer to item that has been checked or unchecked or NULL this item is
          * not checkable.
          */
-        QMenuItem* setCheckable(QMenuItem* item, bool checked) {
+        Item* setCheckable(Item* item, bool checked) {
             if (item != NULL && item->isCheckable()) {
                 item->setChecked(checked);
                 return item;
@@ -686,7 +1296,7 @@ class QMenu {
          * @return Returns pointer to item that has been checked or unchecked or NULL this item is
          * not checkable.
          */
-        QMenuItem* toggleCheckable(QMenuItem* item) {
+        Item* toggleCheckable(Item* item) {
             return item != NULL ? setCheckable(item, !item->isChecked()) : NULL;
         }
 
@@ -696,7 +1306,7 @@ class QMenu {
          * @param switchItem Item to be checked in radio group. This item must be radio item.
          * @return Returns pointer to item that has been checked or NULL if item is not radio item.
          */
-        QMenuItem* switchRadio(QMenuItem* switchItem) {
+        Item* switchRadio(Item* switchItem) {
             // If given item is not radio item, invalid call
             if (switchItem == NULL || !switchItem->isRadio()) {
                 return NULL;
@@ -708,7 +1318,7 @@ class QMenu {
             }
 
             // Get first item in given item's level
-            QMenuItem* item = getTopItem(switchItem);
+            Item* item = getTopItem(switchItem);
             byte groupIndex = switchItem->getGroupIndex();
 
             // Loop for all items in level
@@ -727,26 +1337,40 @@ class QMenu {
         }
 };
 
+/* Menu controller, cursor and events of selected policy */
+typedef QMenuCursorT<QMENU_POLICY> QMenuCursor;
+typedef QMenuT<QMENU_POLICY> QMenu;
+typedef QMenuActiveItemChangedEventT<QMenuItem> QMenuActiveItemChangedEvent;
+typedef QMenu::ActiveItemChangedCallback QMenuActiveItemChangedCallback;
+typedef QMenuItemUtilizedEventT<QMenuItem> QMenuItemUtilizedEvent;
+typedef QMenu::ItemUtilizedCallback QMenuItemUtilizedCallback;
+
 /** QMenuRenderer onItemRender event data */
-struct QMenuRenderItemEvent {
-    const QMenuItem* item;
+template <typename Item>
+struct QMenuRenderItemEventT {
+    const Item* item;
     const boolean isActive;
     const int menuIndex;
     const int renderIndex;
+    const boolean isEditing;
 };
 
-/** QMenuRenderer onItemRender event */
-typedef void (*QMenuOnRenderItemCallback) (QMenuRenderItemEvent);
-
 /**
  * @brief Rendering machine for menu backend controller.
  */
-class QMenuRenderer {
+template <typename Policy>
+class QMenuRendererT {
+    public:
+        typedef QMenuItemT<Policy> Item;
+
+        /** QMenuRenderer onItemRender event */
+        typedef void (*RenderItemCallback) (QMenuRenderItemEventT<Item>);
+
     private:
-        QMenuOnRenderItemCallback _onRenderItem;
+        RenderItemCallback _onRenderItem = NULL;
 
     protected:
-        QMenu* menu;
+        QMenuCursorT<Policy>* cursor;
 
         /**
          * @brief Calls assigned render callback.
@@ -754,10 +1378,12 @@ class QMenuRenderer {
          * @param isActive Set to true to mark rendered item as curretly selected.
          * @param menuIndex Zero based item index of whole menu.
          * @param renderIndex Zero based item index in menu viewport.
+         * @param isEditing Set to true if rendered item value is edited inline.
          */
-        void renderItem(QMenuItem* item, boolean isActive, int menuIndex, int renderIndex) {
+        void renderItem(Item* item, boolean isActive, int menuIndex, int renderIndex,
+                boolean isEditing = false) {
             if (this->_onRenderItem) {
-                QMenuRenderItemEvent event = { item, isActive, menuIndex, renderIndex };
+                QMenuRenderItemEventT<Item> event = { item, isActive, menuIndex, renderIndex, isEditing };
                 this->_onRenderItem(event);
             }
         }
@@ -765,10 +1391,18 @@ class QMenuRenderer {
     public:
         /**
          * @brief Creates new QMenuRenderer instance.
-         * @param menu Menu to redner.
+         * @param menu Menu to redner via its default cursor.
+         */
+        QMenuRendererT(QMenuT<Policy>* menu) {
+            this->cursor = menu->getCursor();
+        }
+
+        /**
+         * @brief Creates new QMenuRenderer instance.
+         * @param cursor Menu cursor to redner.
          */
-        QMenuRenderer(QMenu* menu) {
-            this->menu = menu;
+        QMenuRendererT(QMenuCursorT<Policy>* cursor) {
+            this->cursor = cursor;
         }
 
         /**
@@ -776,7 +1410,7 @@ class QMenuRenderer {
          * @return Returns onRenderItemCallbackEventCallback function reference or
          * NULL if not assigned.
          */
-        QMenuOnRenderItemCallback getOnRenderItem() {
+        RenderItemCallback getOnRenderItem() {
             return this->_onRenderItem;
         }
 
@@ -784,116 +1418,520 @@ class QMenuRenderer {
          * @brief Sets render item callback called when menu item has to be rendered.
          * @param The onRenderItemCallbackEventCallback function.
          */
-        void setOnRenderItem(QMenuOnRenderItemCallback onRenderItemCallback) {
+        void setOnRenderItem(RenderItemCallback onRenderItemCallback) {
             this->_onRenderItem = onRenderItemCallback;
         }
 };
 
+/* Renderer and events of selected policy */
+typedef QMenuRendererT<QMENU_POLICY> QMenuRenderer;
+typedef QMenuRenderItemEventT<QMenuItem> QMenuRenderItemEvent;
+typedef QMenuRenderer::RenderItemCallback QMenuOnRenderItemCallback;
+
 /**
  * @brief List menu renderer.
  */
-class QMenuListRenderer : public QMenuRenderer {
+template <typename Policy>
+class QMenuListRendererT : public QMenuRendererT<Policy> {
+    public:
+        typedef QMenuItemT<Policy> Item;
+
     private:
+        // First visible item in viewport and its visible index in menu level
+        Item* _viewportTop = NULL;
         int _viewportIndex = 0;
         int _viewportSize;
 
+        // Item revision the viewport has been computed for
+        byte _revision;
+
+        // Inline edit mode of active item
+        boolean _editing = false;
+
+        // Viewport rows of active item as of last render or viewport update and of previously
+        // active item, -1 if none
+        int _activeRenderIndex = -1;
+        int _previousRenderIndex = -1;
+
     protected:
         /**
-         * @brief Calculates index of menu item in viewport.
-         * @param top First item of current submenu.
+         * @brief Moves viewport to contain active item. Viewport is moved incrementally from
+         *      its last position, menu level is rescanned only when level or item revision changes.
          * @param active Currently active menu item.
+         * @param activeIndex Visible index of active item in its menu level.
+         * @return Returns true if viewport has been reset to the top of another level.
          */
-        void calcViewportIndex(QMenuItem* top, QMenuItem* active) {
-            int index = 0;
-            QMenuItem* item = top;
-            while (item != NULL) {
+        bool calcViewport(Item* active, int activeIndex) {
+            bool reset = false;
+
+            // Reset viewport to the top of new level
+            if (this->_viewportTop == NULL || this->_viewportTop->getBack() != active->getBack()
+                    || this->_revision != Item::getRevision()) {
+                this->_viewportTop = active->getTop()->getFirstVisible();
+                this->_viewportIndex = 0;
+                this->_revision = Item::getRevision();
+                reset = true;
+            }
 
-                // Check active item in viewport
-                if (item == active) {
+            // Active item before view port
+            if (activeIndex < this->_viewportIndex) {
+                this->_viewportTop = active;
+                this->_viewportIndex = activeIndex;
+            }
 
-                    // Active item before view port
-                    if (index < this->_viewportIndex) {
-                        this->_viewportIndex = index;
-                        break;
-                    }
+            // Active item after viewport
+            while (activeIndex >= this->_viewportIndex + this->_viewportSize) {
+                this->_viewportTop = this->_viewportTop->getNextVisible();
+                this->_viewportIndex++;
+            }
 
-                    // Active item after viewport
-                    if (index >= this->_viewportIndex + this->_viewportSize) {
-                        this->_viewportIndex = index - this->_viewportSize + 1;
-                        break;
-                    }
-                }
+            return reset;
+        }
 
-                // Next item
-                item = item->getNext();
-                index++;
+        /**
+         * @brief Calls rendering for all visible items in viewport.
+         * @param active Currently active item in rendered menu level.
+         */
+        void renderItemsInViewport(Item* active) {
+            Item* item = this->_viewportTop;
+            for (int index = 0; item != NULL && index < this->_viewportSize; index++) {
+                this->renderItem(item, item == active, this->_viewportIndex + index, index,
+                        item == active && this->_editing);
+                item = item->getNextVisible();
             }
         }
 
+    public:
         /**
-         * @brief Calls rendering for all items in viewport.
-         * @param top Top item of rendered menu level.
-         * @param active Currently active item in rendered menu level.
+         * @brief Creates new QMenuRenderer instance.
+         * @param menu Menu to redner.
+         * @param viewportSize Number of menu items mutually visible.
          */
-        void renderItemsInViewport(QMenuItem* top, QMenuItem* active) {
-            int index = 0;
-            QMenuItem* item = top;
-            while (item != NULL) {
+        QMenuListRendererT(QMenuT<Policy>* menu, int viewportSize)
+            : QMenuRendererT<Policy>(menu)
+        {
+            this->_viewportSize = viewportSize;
+        }
+
+        /**
+         * @brief Creates new QMenuRenderer instance with own viewport over menu cursor.
+         * @param cursor Menu cursor to redner.
+         * @param viewportSize Number of menu items mutually visible.
+         */
+        QMenuListRendererT(QMenuCursorT<Policy>* cursor, int viewportSize)
+            : QMenuRendererT<Policy>(cursor)
+        {
+            this->_viewportSize = viewportSize;
+        }
+
+        /**
+         * @brief Gets if active item value is edited inline.
+         */
+        boolean isEditing() {
+            return _editing;
+        }
+
+        /**
+         * @brief Sets inline edit mode. Active item is rendered with isEditing flag, so its row
+         *      could show edited value in place, e.g. at the right edge.
+         * @param editing Set to true to edit active item value inline or false to end editing.
+         */
+        void setEditing(boolean editing) {
+            _editing = editing;
+        }
+
+        /**
+         * @brief Gets visible index of the first item in viewport.
+         */
+        int getViewportIndex() {
+            return _viewportIndex;
+        }
+
+        /**
+         * @brief Moves viewport to contain active item without rendering, so display backend
+         *      could shift already drawn rows, e.g. by hardware scrolling, and render only the
+         *      rest.
+         * @return Returns number of rows viewport moved down (negative when moved up) or
+         *      QMENU_VIEWPORT_RESET if viewport has been reset to another menu level.
+         */
+        int updateViewport() {
+            Item* active = this->cursor != NULL ? this->cursor->getActive() : NULL;
+            if (active == NULL) {
+                return 0;
+            }
+
+            int viewportIndex = _viewportIndex;
+            bool reset = calcViewport(active, this->cursor->getActiveIndex());
+            int moved = _viewportIndex - viewportIndex;
+            _previousRenderIndex = !reset && _activeRenderIndex >= 0
+                    ? _activeRenderIndex - moved : -1;
+            _activeRenderIndex = this->cursor->getActiveIndex() - _viewportIndex;
+            return reset ? QMENU_VIEWPORT_RESET : moved;
+        }
+
+        /**
+         * @brief Gets viewport row of active item as of last render. Value edited inline changes
+         *      only this row, so it is the only row which has to be repainted.
+         * @return Returns zero based row index in viewport.
+         */
+        int getActiveRenderIndex() {
+            return _activeRenderIndex >= 0 ? _activeRenderIndex : 0;
+        }
+
+        /**
+         * @brief Gets viewport row of item which has been active before last viewport update,
+         *      so its row could be repainted without rescanning menu level.
+         * @return Returns zero based row index in viewport, it is out of viewport if the item
+         *      has been scrolled out, or -1 if unknown.
+         */
+        int getPreviousRenderIndex() {
+            return _previousRenderIndex;
+        }
+
+        /**
+         * @brief Renders associated menu. Calculates visible items that has to be rendered to
+         * current viewport and calls callback to provide user defined item draw.
+         */
+        void render() {
+            // Check cursor set
+            if (this->cursor == NULL) {
+                return;
+            }
+
+            // Check active set
+            Item* active = this->cursor->getActive();
+            if (active == NULL) {
+                return;
+            }
+
+            // Calc viewport position
+            calcViewport(active, this->cursor->getActiveIndex());
+            _activeRenderIndex = this->cursor->getActiveIndex() - _viewportIndex;
+
+            // Render viewport
+            renderItemsInViewport(active);
+        }
+};
+
+/* List renderer of selected policy */
+typedef QMenuListRendererT<QMENU_POLICY> QMenuListRenderer;
+
+/** Grid renderer cell geometry in pixels */
+struct QMenuGridCell {
+    byte left;
+    byte top;
+    byte width;
+    byte height;
+};
+
+/**
+ * @brief Grid menu renderer. Items are laid out to icon cells by rows, caption of active item
+ * is shown in a single caption line under the grid. Cells and caption line are aligned to
+ * display pages (up to 8 pages), so the cells changed by selection move map to whole pages
+ * which could be rendered alone by page mode display.
+ *
+ * Items are rendered by the same render item callback as by list renderer, callback gets cell
+ * geometry by getCell(event.renderIndex) and draws caption of active item to getCaption().
+ */
+template <typename Policy>
+class QMenuGridRendererT : public QMenuRendererT<Policy> {
+    public:
+        typedef QMenuItemT<Policy> Item;
+
+    private:
+        // First visible item in viewport and its visible index in menu level, viewport is
+        // moved by whole grid rows
+        Item* _viewportTop = NULL;
+        int _viewportIndex = 0;
+
+        // Cached grid geometry
+        byte _columns;
+        byte _rows;
+        byte _cellWidth;
+        byte _cellHeight;
+        byte _captionTop;
+        byte _captionHeight;
+
+        // Item revision the viewport has been computed for
+        byte _revision;
+
+        // Inline edit mode of active item
+        boolean _editing = false;
+
+        // Viewport cell and level of active item as of last render or viewport update, -1 if
+        // none
+        int _activeRenderIndex = -1;
+        const Item* _activeLevel = NULL;
+
+        // Display pages changed by last viewport update
+        byte _dirtyPages = 0xFF;
+
+        /**
+         * @brief Computes cached grid geometry.
+         * @param width Display width.
+         * @param height Display height.
+         * @param captionHeight Height of caption line, rounded up to whole pages.
+         */
+        void setGeometry(byte width, byte height, byte columns, byte rows, byte captionHeight) {
+            _columns = columns;
+            _rows = rows;
+            _captionHeight = (captionHeight + QMENU_GRID_PAGE_HEIGHT - 1)
+                    & ~(QMENU_GRID_PAGE_HEIGHT - 1);
+            _cellWidth = width / columns;
+            _cellHeight = ((height - _captionHeight) / rows) & ~(QMENU_GRID_PAGE_HEIGHT - 1);
+            _captionTop = _cellHeight * rows;
+        }
+
+        /**
+         * @brief Gets mask of display pages covering lines band.
+         */
+        byte getBandPages(byte top, byte height) {
+            byte pages = (1 << (height / QMENU_GRID_PAGE_HEIGHT)) - 1;
+            return pages << (top / QMENU_GRID_PAGE_HEIGHT);
+        }
 
-                // Render item if in viewport
-                if (index >= this->_viewportIndex) {
-                    renderItem(item, item == active, index, index - this->_viewportIndex);
+    protected:
+        /**
+         * @brief Moves viewport by grid rows to contain active item. Viewport is moved
+         *      incrementally from its last position, menu level is rescanned only when level
+         *      or item revision changes.
+         * @param active Currently active menu item.
+         * @param activeIndex Visible index of active item in its menu level.
+         * @return Returns true if viewport has been reset to the top of another level.
+         */
+        bool calcViewport(Item* active, int activeIndex) {
+            bool reset = false;
+
+            // Reset viewport to the top of new level
+            if (this->_viewportTop == NULL || this->_viewportTop->getBack() != active->getBack()
+                    || this->_revision != Item::getRevision()) {
+                this->_viewportTop = active->getTop()->getFirstVisible();
+                this->_viewportIndex = 0;
+                this->_revision = Item::getRevision();
+                reset = true;
+            }
+
+            // Active item before viewport, the first item of its row becomes viewport top
+            if (activeIndex < this->_viewportIndex) {
+                this->_viewportTop = active;
+                this->_viewportIndex = activeIndex;
+                while (this->_viewportIndex % this->_columns != 0) {
+                    this->_viewportTop = this->_viewportTop->getPrevVisible();
+                    this->_viewportIndex--;
                 }
+            }
 
-                // All renderred, break
-                if (index >= this->_viewportIndex + this->_viewportSize - 1) {
-                    break;
+            // Active item after viewport
+            while (activeIndex >= this->_viewportIndex + this->_columns * this->_rows) {
+                for (byte column = 0; column < this->_columns; column++) {
+                    this->_viewportTop = this->_viewportTop->getNextVisible();
+                    this->_viewportIndex++;
                 }
+            }
 
-                // Next item
-                item = item->getNext();
-                index++;
+            return reset;
+        }
+
+        /**
+         * @brief Calls rendering for all visible items in viewport.
+         * @param active Currently active item in rendered menu level.
+         */
+        void renderItemsInViewport(Item* active) {
+            Item* item = this->_viewportTop;
+            int size = this->_columns * this->_rows;
+            for (int index = 0; item != NULL && index < size; index++) {
+                this->renderItem(item, item == active, this->_viewportIndex + index, index,
+                        item == active && this->_editing);
+                item = item->getNextVisible();
             }
         }
 
     public:
         /**
-         * @brief Creates new QMenuRenderer instance.
+         * @brief Creates new QMenuGridRenderer instance.
          * @param menu Menu to redner.
-         * @param viewportSize Number of menu items mutually visible.
+         * @param width Display width in pixels.
+         * @param height Display height in pixels, up to 8 pages.
+         * @param columns Number of cells in grid row.
+         * @param rows Number of grid rows, cell height is rounded down to whole pages.
+         * @param captionHeight Caption line height, rounded up to whole pages.
          */
-        QMenuListRenderer(QMenu* menu, int viewportSize)
-            : QMenuRenderer(menu)
+        QMenuGridRendererT(QMenuT<Policy>* menu, byte width, byte height, byte columns,
+                byte rows, byte captionHeight)
+            : QMenuRendererT<Policy>(menu)
         {
-            this->_viewportSize = viewportSize;
+            setGeometry(width, height, columns, rows, captionHeight);
         }
 
         /**
-         * @brief Renders associated menu. Calculates items that has to be rendered to current
-         * viewport and calls callback to provide user defined item
-         * draw.
+         * @brief Creates new QMenuGridRenderer instance with own viewport over menu cursor.
+         * @param cursor Menu cursor to redner.
+         * @param width Display width in pixels.
+         * @param height Display height in pixels, up to 8 pages.
+         * @param columns Number of cells in grid row.
+         * @param rows Number of grid rows, cell height is rounded down to whole pages.
+         * @param captionHeight Caption line height, rounded up to whole pages.
+         */
+        QMenuGridRendererT(QMenuCursorT<Policy>* cursor, byte width, byte height, byte columns,
+                byte rows, byte captionHeight)
+            : QMenuRendererT<Policy>(cursor)
+        {
+            setGeometry(width, height, columns, rows, captionHeight);
+        }
+
+        /**
+         * @brief Gets if active item value is edited inline.
+         */
+        boolean isEditing() {
+            return _editing;
+        }
+
+        /**
+         * @brief Sets inline edit mode. Active item is rendered with isEditing flag, so its
+         *      caption line could show edited value instead of caption.
+         * @param editing Set to true to edit active item value inline or false to end editing.
+         */
+        void setEditing(boolean editing) {
+            _editing = editing;
+        }
+
+        /**
+         * @brief Gets visible index of the first item in viewport.
+         */
+        int getViewportIndex() {
+            return _viewportIndex;
+        }
+
+        /**
+         * @brief Gets geometry of viewport cell.
+         * @param renderIndex Zero based item index in viewport.
+         */
+        QMenuGridCell getCell(int renderIndex) {
+            QMenuGridCell cell = {
+                (byte) (renderIndex % _columns * _cellWidth),
+                (byte) (renderIndex / _columns * _cellHeight),
+                _cellWidth,
+                _cellHeight
+            };
+            return cell;
+        }
+
+        /**
+         * @brief Gets geometry of caption line under the grid.
+         */
+        QMenuGridCell getCaption() {
+            QMenuGridCell caption = { 0, _captionTop, (byte) (_cellWidth * _columns),
+                    _captionHeight };
+            return caption;
+        }
+
+        /**
+         * @brief Gets display pages covering viewport cell.
+         * @param renderIndex Zero based item index in viewport.
+         * @return Returns mask of display pages, bit n is set for page n.
+         */
+        byte getCellPages(int renderIndex) {
+            if (renderIndex < 0 || renderIndex >= _columns * _rows) {
+                return 0;
+            }
+            return getBandPages(renderIndex / _columns * _cellHeight, _cellHeight);
+        }
+
+        /**
+         * @brief Gets display pages covering caption line.
+         * @return Returns mask of display pages, bit n is set for page n.
+         */
+        byte getCaptionPages() {
+            return getBandPages(_captionTop, _captionHeight);
+        }
+
+        /**
+         * @brief Moves viewport to contain active item without rendering and computes display
+         *      pages changed since last render or update, see getDirtyPages().
+         * @return Returns number of grid rows viewport moved down (negative when moved up) or
+         *      QMENU_VIEWPORT_RESET if viewport has been reset to another menu level.
+         */
+        int updateViewport() {
+            Item* active = this->cursor != NULL ? this->cursor->getActive() : NULL;
+            if (active == NULL) {
+                return 0;
+            }
+
+            int viewportIndex = _viewportIndex;
+            int previousRenderIndex = _activeRenderIndex;
+            bool levelChanged = _activeLevel != active->getBack();
+            bool reset = calcViewport(active, this->cursor->getActiveIndex());
+            _activeRenderIndex = this->cursor->getActiveIndex() - _viewportIndex;
+            _activeLevel = active->getBack();
+
+            // Moved viewport or changed level changes all cells, move inside viewport only old
+            // and new cell and caption line
+            if (reset || levelChanged || _viewportIndex != viewportIndex
+                    || previousRenderIndex < 0) {
+                _dirtyPages = 0xFF;
+            } else {
+                _dirtyPages = getCellPages(previousRenderIndex)
+                        | getCellPages(_activeRenderIndex) | getCaptionPages();
+            }
+
+            if (reset || levelChanged) {
+                return QMENU_VIEWPORT_RESET;
+            }
+            return (_viewportIndex - viewportIndex) / _columns;
+        }
+
+        /**
+         * @brief Forgets active item position, so next viewport update reports all pages dirty.
+         *      Call it when display content is replaced by another screen.
+         */
+        void invalidateViewport() {
+            _activeRenderIndex = -1;
+            _activeLevel = NULL;
+        }
+
+        /**
+         * @brief Gets display pages which have to be rendered after last viewport update.
+         * @return Returns mask of display pages, bit n is set for page n.
+         */
+        byte getDirtyPages() {
+            return _dirtyPages;
+        }
+
+        /**
+         * @brief Gets viewport cell of active item as of last render or viewport update.
+         * @return Returns zero based cell index in viewport.
+         */
+        int getActiveRenderIndex() {
+            return _activeRenderIndex >= 0 ? _activeRenderIndex : 0;
+        }
+
+        /**
+         * @brief Renders associated menu. Calculates visible items that has to be rendered to
+         * current viewport and calls callback to provide user defined item draw.
          */
         void render() {
-            // Check menu set
-            if (this->menu == NULL) {
+            // Check cursor set
+            if (this->cursor == NULL) {
                 return;
             }
 
             // Check active set
-            QMenuItem* active = this->menu->getActive();
+            Item* active = this->cursor->getActive();
             if (active == NULL) {
                 return;
             }
 
-            // Get first item in current menu
-            QMenuItem* top = this->menu->getTopItem(active);
-
             // Calc viewport position
-            calcViewportIndex(top, active);
+            calcViewport(active, this->cursor->getActiveIndex());
+            _activeRenderIndex = this->cursor->getActiveIndex() - _viewportIndex;
+            _activeLevel = active->getBack();
 
             // Render viewport
-            renderItemsInViewport(top, active);
+            renderItemsInViewport(active);
         }
 };
 
+/* Grid renderer of selected policy */
+typedef QMenuGridRendererT<QMENU_POLICY> QMenuGridRenderer;
+
 #endif
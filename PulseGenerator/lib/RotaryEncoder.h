@@ -20,6 +20,8 @@
  *      Updated doc comments.
  * @version 1.0 2019-07-04
  *      Stable version
+ * @version 1.1 2026-10-18
+ *      Fixed switch timing after millis() rollover.
  */
 
 #ifndef ROTARY_ENCODER_H
@@ -85,11 +87,14 @@ class RotaryEncoder
         // Long click time measuring
         unsigned long _switchPressTime = 0;
 
+        // Switch pressed flag, press time could be zero after millis() rollover
+        bool _switchPressed = false;
+
         // Long click event fired flag
         bool _longClickFired = false;
 
         // Switch debounce time measure
-        long _lastDebounceSwitchTime;
+        unsigned long _lastDebounceSwitchTime;
 
         // Switch debouncing state
         int _lastDebounceSwitchState = HIGH;
@@ -108,7 +113,7 @@ class RotaryEncoder
             }
             _lastDebounceSwitchState = debounceSwitchState;
 
-            long switchDebounceTime = millis() - _lastDebounceSwitchTime;
+            unsigned long switchDebounceTime = millis() - _lastDebounceSwitchTime;
             if (switchDebounceTime > ROTARY_ENCODER_SWITCH_DEBOUNCE_TIME) {
                 state = debounceSwitchState;
                 return true;
@@ -293,8 +298,8 @@ class RotaryEncoder
             }
             
             // Detect long click
-            if (_switchPressTime > 0 && !_longClickFired) {
-                long delta = millis() - _switchPressTime;
+            if (_switchPressed && !_longClickFired) {
+                unsigned long delta = millis() - _switchPressTime;
                 if (delta > ROTARY_ENCODER_LONG_CLICK_MILLIS) {
                     _longClickFired = true;
                     doOnLongClick();
@@ -310,11 +315,12 @@ class RotaryEncoder
                         if (!_longClickFired) {
                             doOnClick();
                         }
-                        _switchPressTime = 0;
+                        _switchPressed = false;
                         _longClickFired = false;
                         doOnSwitch(release);
                     } else {
                         _switchPressTime = millis();
+                        _switchPressed = true;
                         _longClickFired = false;
                         doOnSwitch(press);
                     }
@@ -0,0 +1,133 @@
+/**
+ * @brief Library for simple line based serial link commands.
+ *
+ * Every command is one line consisting of single command character optionally followed by
+ * decimal integer argument, e.g. `r5` or `p700`. Lines are terminated by CR or LF, spaces are
+ * ignored.
+ *
+ * @author https://github.com/Konajka
+ * @version 0.1 2026-10-18
+ *      Base implementation.
+ * @version 0.2 2026-10-18
+ *      Added feeding characters from other source than stream.
+ */
+
+#ifndef SERIAL_COMMAND_H
+#define SERIAL_COMMAND_H
+
+#include <Arduino.h>
+
+// Command event data
+struct SerialCommandEvent {
+    const char command;
+    const bool hasArgument;
+    const long argument;
+};
+// Command event
+typedef void (*SerialCommandOnCommand) (SerialCommandEvent);
+
+/**
+ * @brief Serial command parser class.
+ */
+class SerialCommand
+{
+    private:
+        // Input stream
+        Stream* _stream;
+
+        // Parsed command
+        char _command = 0;
+        bool _hasArgument = false;
+        bool _negative = false;
+        long _argument = 0;
+
+        // Events
+        SerialCommandOnCommand _onCommand = NULL;
+
+        /**
+         * @brief Clears parsed command.
+         */
+        void clear() {
+            _command = 0;
+            _hasArgument = false;
+            _negative = false;
+            _argument = 0;
+        }
+
+    protected:
+
+        /**
+         * @brief Calls onCommand event if assigned.
+         */
+        void doOnCommand() {
+            if (_onCommand != NULL) {
+                SerialCommandEvent event = {
+                    _command,
+                    _hasArgument,
+                    _negative ? -_argument : _argument
+                };
+                _onCommand(event);
+            }
+        }
+
+    public:
+
+        /**
+         * @brief Parser constructor, assigns input stream.
+         * @param stream Stream commands are read from, e.g. Serial.
+         */
+        SerialCommand(Stream &stream) {
+            _stream = &stream;
+        }
+
+        /**
+         * @brief Gets onCommand callback.
+         * @return Returns assigned callback.
+         */
+        SerialCommandOnCommand getOnCommand() {
+            return _onCommand;
+        }
+
+        /**
+         * @brief Assigns onCommand event callback.
+         * @param onCommand callback to assign.
+         */
+        void setOnCommand(SerialCommandOnCommand onCommand) {
+            _onCommand = onCommand;
+        }
+
+        /**
+         * @brief Reads available characters and calls callback for every complete command. Call
+         * this repeatly in `loop()` method.
+         */
+        void update() {
+            while (_stream->available() > 0) {
+                feed(_stream->read());
+            }
+        }
+
+        /**
+         * @brief Parses single character as if it was read from stream, calls callback when
+         * command is completed.
+         * @param c Character to parse.
+         */
+        void feed(char c) {
+            if (c == '\r' || c == '\n') {
+                if (_command != 0) {
+                    doOnCommand();
+                }
+                clear();
+            } else if (c == ' ') {
+                return;
+            } else if (_command == 0) {
+                _command = c;
+            } else if (c == '-' && !_hasArgument) {
+                _negative = true;
+            } else if (c >= '0' && c <= '9') {
+                _hasArgument = true;
+                _argument = _argument * 10 + (c - '0');
+            }
+        }
+};
+
+#endif
@@ -0,0 +1,84 @@
+/**
+ * @brief Pre-rasterized status bar icons in program memory.
+ *
+ * Icons are 8x8 bitmaps for U8GLIB::drawBitmapP(), one byte per row with the most significant
+ * bit on the left. The bottom row is left blank as a gap under the bar, so the whole bar fits
+ * in display page 0. Digits are 3x5 glyphs in the high nibble of each row, drawn at icon row 1
+ * so they are aligned with the letters of the mode icons.
+ *
+ * @author https://github.com/Konajka
+ * @version 0.1 2026-10-18
+ *      Base implementation.
+ */
+
+#ifndef STATUS_ICONS_H
+#define STATUS_ICONS_H
+
+#include <Arduino.h>
+
+// Icon dimensions
+#define STATUS_ICON_SIZE 8
+#define STATUS_DIGIT_WIDTH 4
+#define STATUS_DIGIT_HEIGHT 5
+#define STATUS_DIGIT_TOP 1
+
+/* Smooth filter on, filled funnel */
+const uint8_t statusIconFilterOn[STATUS_ICON_SIZE] PROGMEM = {
+    0xFE, 0xFE, 0x7C, 0x38, 0x10, 0x10, 0x10, 0x00
+};
+
+/* Smooth filter off, hollow funnel */
+const uint8_t statusIconFilterOff[STATUS_ICON_SIZE] PROGMEM = {
+    0xFE, 0x82, 0x44, 0x28, 0x10, 0x10, 0x10, 0x00
+};
+
+/* Linear acceleration curve */
+const uint8_t statusIconCurveLinear[STATUS_ICON_SIZE] PROGMEM = {
+    0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x00
+};
+
+/* Quadratic acceleration curve */
+const uint8_t statusIconCurveQuadratic[STATUS_ICON_SIZE] PROGMEM = {
+    0x02, 0x02, 0x04, 0x04, 0x08, 0x30, 0xC0, 0x00
+};
+
+/* Output is running, play sign */
+const uint8_t statusIconRunning[STATUS_ICON_SIZE] PROGMEM = {
+    0x40, 0x60, 0x70, 0x78, 0x70, 0x60, 0x40, 0x00
+};
+
+/* Output is paused, pause sign */
+const uint8_t statusIconPaused[STATUS_ICON_SIZE] PROGMEM = {
+    0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x00
+};
+
+/* Frequency mode in Hz, letters Hz */
+const uint8_t statusIconModeHz[STATUS_ICON_SIZE] PROGMEM = {
+    0x00, 0xAE, 0xA2, 0xE4, 0xA8, 0xAE, 0x00, 0x00
+};
+
+/* Frequency mode in RPM, rotation arrow */
+const uint8_t statusIconModeRpm[STATUS_ICON_SIZE] PROGMEM = {
+    0x3A, 0x46, 0x8E, 0x80, 0x82, 0x44, 0x38, 0x00
+};
+
+/* Faults recorded, warning sign */
+const uint8_t statusIconFault[STATUS_ICON_SIZE] PROGMEM = {
+    0x10, 0x38, 0x6C, 0x6C, 0xFE, 0xEE, 0xFE, 0x00
+};
+
+/* Digits 0 to 9 */
+const uint8_t statusDigits[10][STATUS_DIGIT_HEIGHT] PROGMEM = {
+    {0xE0, 0xA0, 0xA0, 0xA0, 0xE0},
+    {0x40, 0xC0, 0x40, 0x40, 0xE0},
+    {0xE0, 0x20, 0xE0, 0x80, 0xE0},
+    {0xE0, 0x20, 0xE0, 0x20, 0xE0},
+    {0xA0, 0xA0, 0xE0, 0x20, 0x20},
+    {0xE0, 0x80, 0xE0, 0x20, 0xE0},
+    {0xE0, 0x80, 0xE0, 0xA0, 0xE0},
+    {0xE0, 0x20, 0x40, 0x40, 0x40},
+    {0xE0, 0xA0, 0xE0, 0xA0, 0xE0},
+    {0xE0, 0xA0, 0xE0, 0x20, 0xE0}
+};
+
+#endif
@@ -0,0 +1,140 @@
+/**
+ * @brief Strongly typed zero-cost physical units.
+ *
+ * Quantity wraps single integer value tagged by unit, so values of different units can not be
+ * mixed without explicit conversion. All operations are inline constexpr functions, so
+ * conversions of constants are folded at compile time and generated code is the same as for raw
+ * integers. Quantities are trivially copyable with the size of their representation, so they
+ * could be stored in EEPROM structures.
+ *
+ * Define UNITS_CHECKED to check arithmetic and conversion overflows at runtime (debug builds).
+ * Application has to define `void unitsOverflow()` handler then.
+ *
+ * @author https://github.com/Konajka
+ * @version 0.1 2026-10-18
+ *      Base implementation.
+ */
+
+#ifndef UNITS_H
+#define UNITS_H
+
+#include <Arduino.h>
+
+#ifdef UNITS_CHECKED
+// Overflow handler defined by application
+void unitsOverflow();
+// Calls overflow handler if condition is true and returns result
+#define UNITS_CHECK(overflow, result) ((overflow) ? (unitsOverflow(), (result)) : (result))
+#else
+#define UNITS_CHECK(overflow, result) (result)
+#endif
+
+/**
+ * @brief Value of type T in unit identified by Unit tag.
+ */
+template <typename Unit, typename T>
+class Quantity
+{
+    private:
+        T _value;
+
+    public:
+        constexpr Quantity() : _value(0) {}
+
+        /**
+         * @brief Creates quantity from raw value.
+         * @param value Raw value in quantity unit.
+         */
+        explicit constexpr Quantity(T value) : _value(value) {}
+
+        /**
+         * @brief Gets raw value in quantity unit.
+         */
+        constexpr T value() const {
+            return _value;
+        }
+
+        constexpr Quantity operator+(Quantity other) const {
+            return UNITS_CHECK((T) (_value + other._value) < _value,
+                    Quantity((T) (_value + other._value)));
+        }
+
+        constexpr Quantity operator-(Quantity other) const {
+            return UNITS_CHECK(other._value > _value, Quantity((T) (_value - other._value)));
+        }
+
+        constexpr bool operator==(Quantity other) const {
+            return _value == other._value;
+        }
+
+        constexpr bool operator!=(Quantity other) const {
+            return _value != other._value;
+        }
+
+        constexpr bool operator<(Quantity other) const {
+            return _value < other._value;
+        }
+
+        constexpr bool operator<=(Quantity other) const {
+            return _value <= other._value;
+        }
+
+        constexpr bool operator>(Quantity other) const {
+            return _value > other._value;
+        }
+
+        constexpr bool operator>=(Quantity other) const {
+            return _value >= other._value;
+        }
+};
+
+/* Unit tags */
+struct HertzUnit {};
+struct MilliHertzUnit {};
+struct RpmUnit {};
+struct MillisecondsUnit {};
+struct MicrosecondsUnit {};
+struct TicksUnit {};
+
+/* Frequencies */
+typedef Quantity<HertzUnit, word> Hertz;
+typedef Quantity<MilliHertzUnit, unsigned long> MilliHertz;
+typedef Quantity<RpmUnit, word> Rpm;
+
+/* Times, ticks are CPU cycles */
+typedef Quantity<MillisecondsUnit, byte> Milliseconds;
+typedef Quantity<MicrosecondsUnit, unsigned long> Microseconds;
+typedef Quantity<TicksUnit, unsigned long> Ticks;
+
+/* Converts frequency to rotates per minute */
+constexpr Rpm toRpm(Hertz frequency) {
+    return UNITS_CHECK(frequency.value() > 0xFFFF / 60, Rpm(frequency.value() * 60));
+}
+
+/* Converts frequency to millihertz */
+constexpr MilliHertz toMilliHertz(Hertz frequency) {
+    return MilliHertz(frequency.value() * 1000UL);
+}
+
+/* Gets period of frequency, zero frequency has zero period */
+constexpr Microseconds periodOf(Hertz frequency) {
+    return Microseconds(frequency.value() > 0 ? 1000000UL / frequency.value() : 0);
+}
+
+/* Gets period of frequency, zero frequency has zero period */
+constexpr Microseconds periodOf(MilliHertz frequency) {
+    return Microseconds(frequency.value() > 0 ? 1000000000UL / frequency.value() : 0);
+}
+
+/* Converts milliseconds to microseconds */
+constexpr Microseconds toMicroseconds(Milliseconds time) {
+    return Microseconds(time.value() * 1000UL);
+}
+
+/* Converts microseconds to CPU ticks */
+constexpr Ticks toTicks(Microseconds time) {
+    return UNITS_CHECK(time.value() > 0xFFFFFFFFUL / (F_CPU / 1000000UL),
+            Ticks(time.value() * (F_CPU / 1000000UL)));
+}
+
+#endif
@@ -0,0 +1,95 @@
+/**
+ * @brief Compile-time feature profiles of product variants.
+ *
+ * Variant is selected by VARIANT directive (defaults to VARIANT_STANDARD). Features are constant
+ * members of selected VariantConfig specialization, so code guarded by `if (Variant::feature)`
+ * is eliminated by compiler when the feature is off and hot paths carry no runtime checks.
+ * Features which need conditional declarations (serial link, diagnostics, display transport) are
+ * switched by preprocessor here.
+ *
+ * @author https://github.com/Konajka
+ * @version 0.1 2026-10-18
+ *      Base implementation.
+ */
+
+#ifndef VARIANT_H
+#define VARIANT_H
+
+#include <Arduino.h>
+
+/* Product variants */
+#define VARIANT_STANDARD 0
+#define VARIANT_BASIC 1
+#define VARIANT_DEVELOPMENT 2
+
+#ifndef VARIANT
+#define VARIANT VARIANT_STANDARD
+#endif
+
+/**
+ * @brief Variant feature profile, specialized for every variant.
+ *      buzzer - buzzer sounds while generating
+ *      filter - potentiometer smooth filter with menu item
+ *      oledI2cFast - OLED I2C bus at 400 kHz instead of 100 kHz
+ *      menuRows - number of menu rows mutually visible
+ *      inlineEdit - settings values are edited in menu row instead of measure screen
+ *      faultLogSize - number of fault log entries kept, only in variants with diagnostics
+ */
+template <byte variant> struct VariantConfig;
+
+/* Standard product */
+template <> struct VariantConfig<VARIANT_STANDARD> {
+    static const bool buzzer = false;
+    static const bool filter = true;
+    static const bool oledI2cFast = false;
+    static const byte menuRows = 5;
+    static const bool inlineEdit = true;
+    static const byte faultLogSize = 8;
+};
+
+/* Minimal product, no filter and diagnostics */
+template <> struct VariantConfig<VARIANT_BASIC> {
+    static const bool buzzer = false;
+    static const bool filter = false;
+    static const bool oledI2cFast = false;
+    static const byte menuRows = 5;
+    static const bool inlineEdit = false;
+};
+
+/* Development board, standard product with serial link, fast display bus and longer fault log */
+template <> struct VariantConfig<VARIANT_DEVELOPMENT> {
+    static const bool buzzer = false;
+    static const bool filter = true;
+    static const bool oledI2cFast = true;
+    static const byte menuRows = 5;
+    static const bool inlineEdit = true;
+    static const byte faultLogSize = 16;
+};
+
+/* Selected variant */
+typedef VariantConfig<VARIANT> Variant;
+
+/* Serial link */
+#if VARIANT == VARIANT_DEVELOPMENT && !defined(SERIAL_LOG)
+#define SERIAL_LOG
+#endif
+
+/* Diagnostics, fault log with diagnostics menu item, present in all variants but minimal
+ * product. Variants without it do not allocate fault log ring and fault status state. */
+#if VARIANT != VARIANT_BASIC
+#define FAULT_LOG
+#endif
+
+/* Display transport, OLED is connected via I2C unless OLED_TRANSPORT selects hardware SPI */
+#define OLED_TRANSPORT_I2C 0
+#define OLED_TRANSPORT_SPI 1
+#ifndef OLED_TRANSPORT
+#define OLED_TRANSPORT OLED_TRANSPORT_I2C
+#endif
+
+/* Fault log size, fault codes are defined in Faults.h */
+#ifdef FAULT_LOG
+#define FAULT_LOG_SIZE Variant::faultLogSize
+#endif
+
+#endif